@@ -7,7 +7,7 @@ rseed <- "0"
 
 # Read test results data and set column names
 data <- read.csv(paste("test_results_nogap(",testype,")(seed_",rseed,").csv",sep=""), header=T, sep=";")
-colnames(data) <- c("Instance","Seed","Cost","Fractionality","Rounds","LPtime(ms)","ZItime(ms)","LP+ZItime(ms)")
+colnames(data) <- c("Instance","Seed","Cost","Fractionality","Rounds","LPtime(ms)","ZItime(ms)","LP+ZItime(ms)","StallRound","StallSaved","OneOptShifts","ZeroFracRound","MSFeasible","ScanCut(%)")
 
 #! Compute success rate = number of rows with zero fractionality / total number of rows
 
@@ -17,6 +17,11 @@ fracs <- data$Fractionality
 num_succ <- sum(fracs == 0)
 succ_rate <- num_succ / length(fracs) * 100
 
+#! Compute the average number of rounds to reach zero fractionality (successes only)
+
+zfrounds <- data$ZeroFracRound[data$ZeroFracRound > 0]
+avg_zfrounds <- if (length(zfrounds) > 0) mean(zfrounds) else NA
+
 #! Compute the shifted geometric means (SGM) of the LP solve and ZI-Round times, and their ratio ZI/LP
 
 # Get LP solve times and ZI-Round times
@@ -91,14 +96,15 @@ avg_gap <- mean(data[,"Gap(%)"])
 write.table(data, file=paste("test_results(",testype,")(seed_",rseed,").csv",sep=""), row.names=FALSE, dec=".", sep=";", quote=FALSE)
 
 #! Print aggregate measures to file
-names <- c("SuccessRate(%)","SGM-LPtime(ms)","SGM-ZItime(ms)","SGM-ratio(ZI/LP)","AvgGap(%)")
-aggr <- c(succ_rate, sgm_lptime, sgm_zitime, sgm_ratio, avg_gap)
+names <- c("SuccessRate(%)","AvgZeroFracRound","SGM-LPtime(ms)","SGM-ZItime(ms)","SGM-ratio(ZI/LP)","AvgGap(%)")
+aggr <- c(succ_rate, avg_zfrounds, sgm_lptime, sgm_zitime, sgm_ratio, avg_gap)
 df <- t(data.frame(names, aggr))
 write.table(df, file=paste("aggregate_measures(",testype,")(seed_",rseed,").csv",sep=""), row.names=FALSE, col.names=FALSE, dec=".", sep=";", quote=FALSE)
 
 
 #! Print aggregate measures to video
 print(paste("ZI-Round success rate (%):", succ_rate, "%"), quote=FALSE)
+print(paste("ZI-Round avg rounds to zero fractionality:", avg_zfrounds), quote=FALSE)
 print(paste("SGM LP solve time (ms):", sgm_lptime), quote=FALSE)
 print(paste("SGM ZI-Round time (ms):", sgm_zitime), quote=FALSE)
 print(paste("SGM ratio ZI/LP (%):", sgm_ratio, "%"), quote=FALSE)
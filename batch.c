@@ -0,0 +1,420 @@
+/**
+ * @file batch.c
+ * @author Ivan Viviani
+ * @copyright Copyright (c) 2020
+ */
+
+#include "ziround.h"
+
+void batch_round(INSTANCE* inst, int* numrounds) {
+
+	BATCH batch;         /**< Interleaved states of the LP points. */
+	double* delta_up;    /**< Maximum up-shifts of the current variable (one per state). */
+	double* delta_down;  /**< Maximum down-shifts of the current variable (one per state). */
+	double* shift;       /**< Signed shifts of the current variable (one per state). */
+	int* updated;        /**< Flags set to 1 when at least one shift has been made in a state during the current round. */
+	int any_updated;     /**< Flag set to 1 when at least one shift has been made in any state during the current round. */
+	int moved;           /**< Flag set to 1 when the current variable is shifted in at least one state. */
+	int num_states;      /**< Number of states (LP points). */
+	int best;            /**< Index of the best state. */
+	double old_xj;       /**< Value of the current variable before the shift. */
+	double epsilon;      /**< Threshold of the fractional shifts in the current round. */
+	double prev_epsilon; /**< Threshold of the fractional shifts in the previous round. */
+	double* best_frac;   /**< Solution fractionality of each materialized state. */
+	double* best_obj;    /**< Objective value of each materialized state (singletons included). */
+
+	if (inst->batch_x == NULL) print_error("[batch_round]: LP points not available.\n");
+	if ((inst->stall_rounds > 0) || inst->one_opt || (inst->col_order > 0) || (inst->num_starts > 0)) print_warning("[batch_round]: Stall rule, 1-opt, column orders and multi-start are ignored by the batched rounding.\n");
+	if (inst->components) print_warning("[batch_round]: Component rounding not supported by the batched rounding, whole instance rounded.\n"); // [EXTENSION]
+
+	// Allocate / Initialize
+	batch_init(inst, &batch);
+	num_states = batch.size;
+	delta_up   = (double*)malloc(num_states * sizeof(double));
+	delta_down = (double*)malloc(num_states * sizeof(double));
+	shift      = (double*)malloc(num_states * sizeof(double));
+	updated    = (int*)malloc(num_states * sizeof(int));
+	best_frac  = (double*)malloc(num_states * sizeof(double));
+	best_obj   = (double*)malloc(num_states * sizeof(double)); if (delta_up == NULL || delta_down == NULL || shift == NULL || updated == NULL || best_frac == NULL || best_obj == NULL) print_error("[batch_round]: Failed to allocate batch support arrays.\n");
+	*numrounds = 0;
+	epsilon = max(EPSILON, inst->eps_start); prev_epsilon = epsilon;
+
+	// Allocate / Initialize plotting variables (not updated in batch mode)
+	inst->size_frac = 0; inst->size_cost = 0; inst->size_toround = 0;
+	inst->len_frac = 10; inst->len_cost = 10; inst->len_toround = 10;
+	inst->tracker_sol_frac = (double*)calloc(inst->len_frac, sizeof(double));
+	inst->tracker_sol_cost = (double*)calloc(inst->len_cost, sizeof(double));
+	inst->tracker_toround = (double*)calloc(inst->len_toround, sizeof(double)); if (inst->tracker_sol_frac == NULL || inst->tracker_sol_cost == NULL || inst->tracker_toround == NULL) print_error("[batch_round]: Failed to allocate trackers.\n");
+
+	print_verbose(10, "[batch_round]: Rounding %d LP points in lockstep.\n", num_states);
+
+	// Outer loop (repeat until no more updates found in any state)
+	do {
+		any_updated = 0;
+		(*numrounds)++;
+		for (int s = 0; s < num_states; s++) updated[s] = 0;
+
+		// Inner loop (each movable column is read once for all the states)
+		for (int k = 0; k < inst->num_movable; k++) {
+
+			int j = inst->movable[k];
+
+			// Deltas of all the states in one scan of the column
+			batch_deltas(inst, &batch, j, delta_up, delta_down);
+
+			// Shift of each state (same rules as zi_round)
+			moved = 0;
+			for (int s = 0; s < num_states; s++) {
+				shift[s] = (batch.active[s]) ? batch_shift(inst, &batch, j, s, delta_up[s], delta_down[s], epsilon) : 0.0;
+				if (!zero(shift[s])) moved = 1;
+				else shift[s] = 0.0;
+			}
+			if (!moved) continue;
+
+			// Update the slacks of all the states in one scan of the column
+			batch_update(inst, &batch, j, shift);
+
+			for (int s = 0; s < num_states; s++) {
+				if (shift[s] == 0.0) continue;
+				old_xj = batch.x[j * num_states + s];
+				batch.x[j * num_states + s] += shift[s];
+				batch.solfrac[s] += fractionality(batch.x[j * num_states + s]) - fractionality(old_xj);
+				batch.objval[s] += inst->obj[j] * shift[s];
+				updated[s] = 1;
+				any_updated = 1;
+			}
+		} // end inner loop
+
+		// Tighten the threshold of the fractional shifts (straight to EPSILON if nothing moved)
+		prev_epsilon = epsilon;
+		epsilon = (any_updated) ? max(EPSILON, epsilon * inst->eps_decay) : EPSILON;
+
+		// Deactivate the states that did not move at the final threshold
+		for (int s = 0; s < num_states; s++) {
+			if (!(batch.active[s])) continue;
+			batch.numrounds[s] = *numrounds;
+			if ((batch.zerofrac_round[s] == 0) && zero(batch.solfrac[s])) batch.zerofrac_round[s] = *numrounds;
+			if (!updated[s] && (prev_epsilon <= EPSILON)) batch.active[s] = 0;
+		}
+		print_verbose(20, "[batch_round]: ... Round %d done ...\n", *numrounds);
+
+		// Exit outer loop if reached max rounds (>0 activated)
+		if ((inst->max_rounds > 0) && (*numrounds == inst->max_rounds)) break;
+
+	} while (any_updated || prev_epsilon > EPSILON); // end outer loop
+
+	// Select the best state: least fractional first, then best objective (singletons included)
+	best = 0;
+	for (int s = 0; s < num_states; s++) {
+		batch_materialize(inst, &batch, s);
+		best_frac[s] = inst->solfrac;
+		best_obj[s] = inst->objval;
+		print_verbose(20, "[batch_round]: Point %d: solfrac %f | objval %f | rounds %d\n", s, best_frac[s], best_obj[s], batch.numrounds[s]);
+		if (less_than(best_frac[s], best_frac[best])) { best = s; continue; }
+		if (!equals(best_frac[s], best_frac[best])) continue;
+		if ((inst->objsen == CPX_MIN) ? less_than(best_obj[s], best_obj[best]) : greater_than(best_obj[s], best_obj[best])) best = s;
+	}
+	inst->batch_best = best;
+	print_verbose(10, "[batch_round]: Best LP point %d of %d.\n", best, num_states);
+
+	// Copy the best rounding into the instance
+	batch_materialize(inst, &batch, best);
+	*numrounds = batch.numrounds[best];
+	inst->zerofrac_round = batch.zerofrac_round[best];
+	inst->stall_round = 0; inst->stall_saved = 0;
+	inst->oneopt_shifts = 0; inst->oneopt_evals = 0;
+
+	// Free
+	batch_free(&batch);
+	free_all(6, delta_up, delta_down, shift, updated, best_frac, best_obj);
+}
+
+void batch_init(INSTANCE* inst, BATCH* batch) {
+
+	int num_states;   /**< Number of states (LP points). */
+	double* point;    /**< Current LP point (point-major storage of the instance). */
+	nzind_t rowend;   /**< Index of the last variable of the current constraint. */
+	double activity;  /**< Row activity of the current constraint. */
+	int beg;          /**< Index of the first singleton of the current row. */
+
+	num_states = inst->batch_size;
+	batch->size = num_states;
+	build_row_view(inst); // [EXTENSION] Row activities of the LP points (row view built now in CSC-only mode)
+	batch->x          = (double*)malloc((size_t)inst->ncols * num_states * sizeof(double));
+	batch->slack      = (double*)malloc((size_t)inst->nrows * num_states * sizeof(double));
+	batch->objval     = (double*)malloc(num_states * sizeof(double));
+	batch->solfrac    = (double*)malloc(num_states * sizeof(double));
+	batch->numrounds  = (int*)calloc(num_states, sizeof(int));
+	batch->zerofrac_round = (int*)calloc(num_states, sizeof(int));
+	batch->active     = (int*)malloc(num_states * sizeof(int)); if (batch->x == NULL || batch->slack == NULL || batch->objval == NULL || batch->solfrac == NULL || batch->numrounds == NULL || batch->zerofrac_round == NULL || batch->active == NULL) print_error("[batch_init]: Failed to allocate batch states.\n");
+	batch->ss_val = NULL;
+	batch->ss_start = NULL;
+	if (inst->singletons) {
+		batch->ss_val   = (double*)calloc((size_t)inst->nrows * num_states, sizeof(double));
+		batch->ss_start = (double*)calloc((size_t)inst->nrows * num_states, sizeof(double)); if (batch->ss_val == NULL || batch->ss_start == NULL) print_error("[batch_init]: Failed to allocate batch singletons slacks.\n");
+	}
+
+	for (int s = 0; s < num_states; s++) {
+
+		point = &(inst->batch_x[(size_t)s * inst->ncols]);
+		check_bounds(point, inst->lb, inst->ub, inst->ncols);
+
+		// Interleave the solution
+		for (int j = 0; j < inst->ncols; j++) batch->x[j * num_states + s] = point[j];
+
+		// Row slacks (rhs minus row activity) and singletons slacks
+		for (int i = 0; i < inst->nrows; i++) {
+			activity = 0.0;
+			rowend = inst->rmatbeg[i + 1];
+			for (nzind_t k = inst->rmatbeg[i]; k < rowend; k++) activity += inst->rmatval[k] * point[inst->rmatind[k]];
+			batch->slack[i * num_states + s] = inst->rhs[i] - activity;
+
+			if (!(inst->singletons) || (inst->num_singletons[i] == 0)) continue;
+			beg = inst->rs_beg[i];
+			for (int k = 0; k < inst->num_singletons[i]; k++) batch->ss_start[i * num_states + s] += inst->rs_coef[beg + k] * point[inst->row_singletons[beg + k]];
+			batch->ss_val[i * num_states + s] = batch->ss_start[i * num_states + s];
+		}
+
+		batch->objval[s] = dot_product(inst->obj, point, inst->ncols);
+		batch->solfrac[s] = sol_fractionality(point, inst->int_var, inst->ncols);
+		batch->active[s] = 1;
+	}
+}
+
+void batch_deltas(INSTANCE* inst, BATCH* batch, int j, double* delta_up, double* delta_down) {
+
+	int num_states; /**< Number of states. */
+	COL_ITER col;   /**< Iterator over the constraints containing variable x_j. */
+	int rowind;     /**< Current row index. */
+	double aij;     /**< Coefficient of xj in the current constraint. */
+	double* slack;  /**< Row slacks of the current constraint (one per state). */
+	double* ss;     /**< Singletons slacks of the current constraint (one per state, NULL if none). */
+	double ss_lb;   /**< Lower bound of the singletons slack of the current constraint. */
+	double ss_ub;   /**< Upper bound of the singletons slack of the current constraint. */
+	double* xj;     /**< Values of xj (one per state). */
+
+	num_states = batch->size;
+
+	for (int s = 0; s < num_states; s++) {
+		delta_up[s] = LONG_MAX;
+		delta_down[s] = LONG_MAX;
+	}
+
+	// Scan constraints of variable xj once, updating the candidates of all the states
+	for (col_begin(inst, j, &col); col_next(&col, &rowind, &aij); ) {
+
+		slack = &(batch->slack[rowind * num_states]);
+		ss = (inst->singletons && inst->num_singletons[rowind] > 0) ? &(batch->ss_val[rowind * num_states]) : NULL;
+		ss_lb = (ss != NULL) ? inst->ss_lb[rowind] : 0.0;
+		ss_ub = (ss != NULL) ? inst->ss_ub[rowind] : 0.0;
+
+		switch (inst->sense[rowind]) {
+
+			case 'L': // available slack = row slack + decrease of the singletons slack
+				if (aij > 0.0) {
+					#pragma omp simd
+					for (int s = 0; s < num_states; s++) delta_up[s] = min(delta_up[s], (max(0.0, slack[s]) + ((ss != NULL) ? max(0.0, ss[s] - ss_lb) : 0.0)) / aij);
+				}
+				else {
+					#pragma omp simd
+					for (int s = 0; s < num_states; s++) delta_down[s] = min(delta_down[s], -(max(0.0, slack[s]) + ((ss != NULL) ? max(0.0, ss[s] - ss_lb) : 0.0)) / aij);
+				}
+				break;
+
+			case 'G': // available slack = row slack - increase of the singletons slack
+				if (aij < 0.0) {
+					#pragma omp simd
+					for (int s = 0; s < num_states; s++) delta_up[s] = min(delta_up[s], (min(0.0, slack[s]) - ((ss != NULL) ? max(0.0, ss_ub - ss[s]) : 0.0)) / aij);
+				}
+				else {
+					#pragma omp simd
+					for (int s = 0; s < num_states; s++) delta_down[s] = min(delta_down[s], -(min(0.0, slack[s]) - ((ss != NULL) ? max(0.0, ss_ub - ss[s]) : 0.0)) / aij);
+				}
+				break;
+
+			case 'E': // only the singletons slack can move
+				if (ss == NULL) {
+					for (int s = 0; s < num_states; s++) { delta_up[s] = 0.0; delta_down[s] = 0.0; }
+				}
+				else if (aij > 0.0) {
+					#pragma omp simd
+					for (int s = 0; s < num_states; s++) {
+						delta_down[s] = min(delta_down[s], max(0.0, ss_ub - ss[s]) / aij);
+						delta_up[s] = min(delta_up[s], max(0.0, ss[s] - ss_lb) / aij);
+					}
+				}
+				else {
+					#pragma omp simd
+					for (int s = 0; s < num_states; s++) {
+						delta_up[s] = min(delta_up[s], -max(0.0, ss_ub - ss[s]) / aij);
+						delta_down[s] = min(delta_down[s], -max(0.0, ss[s] - ss_lb) / aij);
+					}
+				}
+				break;
+
+			default:
+				print_error("[batch_deltas]: Constraint sense '%c' not included in {'L','G','E'}.\n", inst->sense[rowind]);
+		}
+	}
+
+	// Variable bounds
+	xj = &(batch->x[j * num_states]);
+	#pragma omp simd
+	for (int s = 0; s < num_states; s++) {
+		delta_up[s] = max(0.0, min(delta_up[s], inst->ub[j] - xj[s]));
+		delta_down[s] = max(0.0, min(delta_down[s], xj[s] - inst->lb[j]));
+	}
+}
+
+double batch_shift(INSTANCE* inst, BATCH* batch, int j, int s, double delta_up, double delta_down, const double epsilon) {
+
+	double xj; /**< Value of xj in state s. */
+	double ZI; /**< Fractionality of xj. */
+	double ZIplus;  /**< Fractionality of xj shifted up. */
+	double ZIminus; /**< Fractionality of xj shifted down. */
+
+	xj = batch->x[j * batch->size + s];
+
+	// xj fractional
+	if (is_fractional(xj)) {
+
+		// Clip the deltas if both are less than the threshold of the round
+		if (less_than(delta_up, epsilon) && less_than(delta_down, epsilon)) return 0.0;
+		if (zero(delta_up) && zero(delta_down)) return 0.0;
+
+		ZI      = fractionality(xj);
+		ZIplus  = fractionality(xj + delta_up);
+		ZIminus = fractionality(xj - delta_down);
+
+		if (equals(ZIplus, ZIminus) && less_than(ZIplus, ZI)) return objective_shift(inst->objsen, inst->obj[j], delta_up, delta_down, inst->fractie_worstobj);
+		if (less_than(ZIplus, ZIminus) && less_than(ZIplus, ZI)) return delta_up;
+		if (less_than(ZIminus, ZIplus) && less_than(ZIminus, ZI)) return -(delta_down);
+		return 0.0;
+	}
+
+	// xj non fractional
+	if (!(inst->shift_nonfracvars)) return 0.0;
+	if (inst->after0frac && !zero(batch->solfrac[s])) return 0.0;
+	if (zero(inst->obj[j])) return 0.0;
+
+	// Integral deltas (with epsilon = 1.0)
+	if (less_than(delta_up, 1.0) && less_than(delta_down, 1.0)) return 0.0;
+	if (inst->multi_shift) {
+		delta_up = floor(delta_up + TOLERANCE);
+		delta_down = floor(delta_down + TOLERANCE);
+	}
+	else {
+		delta_up = (equals(delta_up, 1.0)) ? 1.0 : 0.0;
+		delta_down = (equals(delta_down, 1.0)) ? 1.0 : 0.0;
+	}
+	if (zero(delta_up) && zero(delta_down)) return 0.0;
+
+	return objective_shift(inst->objsen, inst->obj[j], delta_up, delta_down, 0);
+}
+
+double objective_shift(int objsen, double objcoef, double delta_up, double delta_down, int worstobj) {
+
+	double coef;           /**< Objective coefficient of the equivalent minimization. */
+	double obj_deltaplus;  /**< Delta obj if xj is shifted up. */
+	double obj_deltaminus; /**< Delta obj if xj is shifted down. */
+
+	coef = (objsen == CPX_MIN) ? objcoef : -objcoef;
+	obj_deltaplus = (zero(coef)) ? 0.0 : (coef * delta_up);
+	obj_deltaminus = (zero(coef)) ? 0.0 : -(coef * delta_down);
+
+	// Same cases of round_xj_bestobj / round_xj_worstobj
+	if (negative(obj_deltaplus) && less_than(obj_deltaplus, obj_deltaminus)) return (worstobj) ? -(delta_down) : delta_up;
+	if (negative(obj_deltaminus) && less_than(obj_deltaminus, obj_deltaplus)) return (worstobj) ? delta_up : -(delta_down);
+	if (equals(obj_deltaminus, obj_deltaplus) && negative(obj_deltaminus)) return -(delta_down);
+	if (zero(obj_deltaplus) && zero(obj_deltaminus)) return delta_up;
+	return 0.0;
+}
+
+void batch_update(INSTANCE* inst, BATCH* batch, int j, double* shift) {
+
+	int num_states; /**< Number of states. */
+	COL_ITER col;   /**< Iterator over the constraints containing variable x_j. */
+	int rowind;     /**< Current row index. */
+	double aij;     /**< Coefficient of xj in the current constraint. */
+	double* slack;  /**< Row slacks of the current constraint (one per state). */
+	double* ss;     /**< Singletons slacks of the current constraint (one per state, NULL if none). */
+
+	num_states = batch->size;
+
+	// Scan constraints of variable xj once, updating the slacks of all the states (same rules as update_slacks)
+	for (col_begin(inst, j, &col); col_next(&col, &rowind, &aij); ) {
+
+		slack = &(batch->slack[rowind * num_states]);
+		ss = (inst->singletons && inst->num_singletons[rowind] > 0) ? &(batch->ss_val[rowind * num_states]) : NULL;
+
+		switch (inst->sense[rowind]) {
+
+			case 'L': // row slack first, then decrease the singletons slack
+				if (ss != NULL) {
+					#pragma omp simd
+					for (int s = 0; s < num_states; s++) {
+						double temp = slack[s] - aij * shift[s]; // row slack after the shift, before resorting to the singletons
+						slack[s] = max(0.0, temp);
+						ss[s] += min(0.0, temp);
+					}
+				}
+				else {
+					#pragma omp simd
+					for (int s = 0; s < num_states; s++) slack[s] -= aij * shift[s];
+				}
+				break;
+
+			case 'G': // row slack first, then increase the singletons slack
+				if (ss != NULL) {
+					#pragma omp simd
+					for (int s = 0; s < num_states; s++) {
+						double temp = slack[s] - aij * shift[s]; // row slack after the shift, before resorting to the singletons
+						slack[s] = min(0.0, temp);
+						ss[s] += max(0.0, temp);
+					}
+				}
+				else {
+					#pragma omp simd
+					for (int s = 0; s < num_states; s++) slack[s] -= aij * shift[s];
+				}
+				break;
+
+			case 'E': // singletons slack only
+				if (ss != NULL) {
+					#pragma omp simd
+					for (int s = 0; s < num_states; s++) ss[s] -= aij * shift[s];
+				}
+				break;
+
+			default:
+				print_error("[batch_update]: Constraint sense %c not supported!\n", inst->sense[rowind]);
+		}
+	}
+}
+
+void batch_materialize(INSTANCE* inst, BATCH* batch, int s) {
+
+	int num_states; /**< Number of states. */
+
+	num_states = batch->size;
+
+	// Solution (singletons still at the values of the LP point), slacks and objective
+	for (int j = 0; j < inst->ncols; j++) inst->x[j] = batch->x[j * num_states + s];
+	for (int i = 0; i < inst->nrows; i++) inst->rows[i].slack = batch->slack[i * num_states + s];
+	inst->objval = batch->objval[s];
+	inst->solfrac = batch->solfrac[s];
+
+	// Distribute the total change of each singletons slack among its singletons (updates the objective)
+	if (!(inst->singletons)) return;
+	for (int i = 0; i < inst->nrows; i++) if (inst->num_singletons[i] > 0) inst->ss_val[i] = batch->ss_val[i * num_states + s];
+	reset_singletons_skips(inst);
+	load_singletons(inst);
+	materialize_singletons(inst);
+	store_singletons(inst);
+}
+
+void batch_free(BATCH* batch) {
+
+	free_all(9, batch->x, batch->slack, batch->ss_val, batch->ss_start, batch->objval, batch->solfrac, batch->numrounds, batch->zerofrac_round, batch->active);
+	batch->size = 0;
+}
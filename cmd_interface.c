@@ -17,11 +17,33 @@ void parse_cmd(int argc, char** argv, INSTANCE* inst, char* test_type) {
 		if (!strcmp(argv[i], "-singletons"))      { inst->singletons        = atoi(argv[++i]); continue; }
 		if (!strcmp(argv[i], "-nonfracvars"))     { inst->shift_nonfracvars = atoi(argv[++i]); continue; }
 		if (!strcmp(argv[i], "-sortsinglet"))     { inst->sort_singletons   = atoi(argv[++i]); continue; }
+		if (!strcmp(argv[i], "-lazysinglet"))     { inst->lazy_singletons   = atoi(argv[++i]); continue; }
+		if (!strcmp(argv[i], "-csconly"))         { inst->csc_only          = atoi(argv[++i]); continue; }
+		if (!strcmp(argv[i], "-mmap"))            { inst->mmap_store        = atoi(argv[++i]); continue; }
+		if (!strcmp(argv[i], "-compress"))        { inst->compress_csc      = atoi(argv[++i]); continue; }
+		if (!strcmp(argv[i], "-float"))           { inst->mixed_precision   = atoi(argv[++i]); continue; }
+		if (!strcmp(argv[i], "-introws"))         { inst->int_rows          = atoi(argv[++i]); continue; }
+		if (!strcmp(argv[i], "-resync"))          { inst->resync_rounds     = atoi(argv[++i]); continue; }
+		if (!strcmp(argv[i], "-rcm"))             { inst->rcm               = atoi(argv[++i]); continue; }
+		if (!strcmp(argv[i], "-presolve"))        { inst->presolve          = atoi(argv[++i]); continue; }
 		if (!strcmp(argv[i], "-after0frac"))      { inst->after0frac        = atoi(argv[++i]); continue; }
+		if (!strcmp(argv[i], "-multishift"))      { inst->multi_shift       = atoi(argv[++i]); continue; }
+		if (!strcmp(argv[i], "-oneopt"))          { inst->one_opt           = atoi(argv[++i]); continue; }
+		if (!strcmp(argv[i], "-sell"))            { inst->sell_oneopt       = atoi(argv[++i]); continue; }
+		if (!strcmp(argv[i], "-colorder"))        { inst->col_order         = atoi(argv[++i]); continue; }
+		if (!strcmp(argv[i], "-multistart"))      { inst->num_starts        = atoi(argv[++i]); continue; }
+		if (!strcmp(argv[i], "-components"))      { inst->components        = atoi(argv[++i]); continue; }
+		if (!strcmp(argv[i], "-batch"))           { inst->batch_size        = atoi(argv[++i]); continue; }
 		if (!strcmp(argv[i], "-maxrounds"))       { inst->max_rounds        = atoi(argv[++i]); continue; }
 		if (!strcmp(argv[i], "-fractieworstobj")) { inst->fractie_worstobj  = atoi(argv[++i]); continue; }
 		if (!strcmp(argv[i], "-timelimit"))       { inst->timelimit         = atoi(argv[++i]); continue; }
 		if (!strcmp(argv[i], "-rseed"))           { inst->rseed             = atoi(argv[++i]); continue; }
+		if (!strcmp(argv[i], "-stallrounds"))     { inst->stall_rounds      = atoi(argv[++i]); continue; }
+		if (!strcmp(argv[i], "-stallfrac"))       { inst->stall_frac        = atof(argv[++i]); continue; }
+		if (!strcmp(argv[i], "-stallobj"))        { inst->stall_obj         = atof(argv[++i]); continue; }
+		if (!strcmp(argv[i], "-stallaction"))     { inst->stall_action      = atoi(argv[++i]); continue; }
+		if (!strcmp(argv[i], "-epsstart"))        { inst->eps_start         = atof(argv[++i]); continue; }
+		if (!strcmp(argv[i], "-epsdecay"))        { inst->eps_decay         = atof(argv[++i]); continue; }
 		if (!strcmp(argv[i], "-testype"))         { strcpy(test_type, argv[++i]);              continue; }
 		if (!strcmp(argv[i], "--help"))           { help = 1;                                  continue; }
 		if (!strcmp(argv[i], "-help"))            { help = 1;                                  continue; }
@@ -38,11 +60,33 @@ void parse_cmd(int argc, char** argv, INSTANCE* inst, char* test_type) {
 	print_verbose(10, "[] singletons %d\n",      inst->singletons);
 	print_verbose(10, "[] nonfracvars %d\n",     inst->shift_nonfracvars);
 	print_verbose(10, "[] sortsinglet %d\n",     inst->sort_singletons);
+	print_verbose(10, "[] lazysinglet %d\n",     inst->lazy_singletons);
+	print_verbose(10, "[] csconly %d\n",         inst->csc_only);
+	print_verbose(10, "[] mmap %d\n",            inst->mmap_store);
+	print_verbose(10, "[] compress %d\n",        inst->compress_csc);
+	print_verbose(10, "[] float %d\n",           inst->mixed_precision);
+	print_verbose(10, "[] introws %d\n",         inst->int_rows);
+	print_verbose(10, "[] resync %d\n",          inst->resync_rounds);
+	print_verbose(10, "[] rcm %d\n",             inst->rcm);
+	print_verbose(10, "[] presolve %d\n",        inst->presolve);
 	print_verbose(10, "[] after0frac %d\n",      inst->after0frac);
+	print_verbose(10, "[] multishift %d\n",      inst->multi_shift);
+	print_verbose(10, "[] oneopt %d\n",          inst->one_opt);
+	print_verbose(10, "[] sell %d\n",            inst->sell_oneopt);
+	print_verbose(10, "[] colorder %d\n",        inst->col_order);
+	print_verbose(10, "[] multistart %d\n",      inst->num_starts);
+	print_verbose(10, "[] components %d\n",      inst->components);
+	print_verbose(10, "[] batch %d\n",           inst->batch_size);
 	print_verbose(10, "[] maxrounds %d\n",       inst->max_rounds);
 	print_verbose(10, "[] fractieworstobj %d\n", inst->fractie_worstobj);
 	print_verbose(10, "[] timelimit %d\n",       inst->timelimit);
 	print_verbose(10, "[] rseed %d\n",           inst->rseed);
+	print_verbose(10, "[] stallrounds %d\n",     inst->stall_rounds);
+	print_verbose(10, "[] stallfrac %f\n",       inst->stall_frac);
+	print_verbose(10, "[] stallobj %f\n",        inst->stall_obj);
+	print_verbose(10, "[] stallaction %d\n",     inst->stall_action);
+	print_verbose(10, "[] epsstart %e\n",        inst->eps_start);
+	print_verbose(10, "[] epsdecay %f\n",        inst->eps_decay);
 	print_verbose(10, "--------------------------------------------------------------------------------\n\n");
 
 	// Help menu
@@ -53,12 +97,34 @@ void parse_cmd(int argc, char** argv, INSTANCE* inst, char* test_type) {
 		print_verbose(10, "[] -singletons [1|0]:          Flag for controlling the use of singletons in ZI-Round (default 1 = ON).\n");
 		print_verbose(10, "[] -nonfracvars [1|0]:         Flag for controlling the shifting of also non-fractional integer variables in ZI-Round (default 1 = ON).\n");
 		print_verbose(10, "[] -sortsinglet [1|0]:         Flag for controlling the sorting of the singletons in ascending order of objective coefficients (default 0 = OFF).\n");
+		print_verbose(10, "[] -lazysinglet [1|0]:         Flag for updating only the aggregated singletons slacks during the rounding, and the singletons at the end (default 0 = OFF).\n");
+		print_verbose(10, "[] -csconly [1|0]:             Flag for storing the constraint matrix only by columns, the row view is built only for 1-opt and batch (default 0 = OFF).\n");
+		print_verbose(10, "[] -mmap [1|0]:                Flag for keeping the matrix by columns, objective, bounds and types in a memory-mapped temporary file, implies -csconly 1 (default 0 = OFF).\n");
+		print_verbose(10, "[] -compress [1|0]:            Flag for compressing the matrix by columns (varint row index deltas, coefficient dictionary if at most 256 distinct values) (default 0 = OFF).\n");
+		print_verbose(10, "[] -float [1|0]:               Flag for storing the coefficients in single precision, only if exact (default 0 = OFF).\n");
+		print_verbose(10, "[] -introws [1|0]:             Flag for exact integer slacks and integer ratio tests on the rows with only integer coefficients and columns (default 0 = OFF).\n");
+		print_verbose(10, "[] -resync <int>:              Number of rounds between two recomputations from scratch of objective, fractionality and row slacks (default 0 = never).\n");
+		print_verbose(10, "[] -rcm [1|0]:                 Flag for renumbering the rows in reverse Cuthill-McKee order for the locality of the row slacks (default 0 = OFF).\n");
+		print_verbose(10, "[] -presolve [1|0]:            Flag for presolving the problem (fixed columns, empty, singleton, redundant and duplicate rows, bound tightening) before the LP solve, and postsolving the rounded solution (default 0 = OFF).\n");
 		print_verbose(10, "[] -after0frac [1|0]:          Flag for activating the shifting of also non-fractional integer variables in ZI-Round only when fractionality reaches zero (default 0 = OFF).\n");
+		print_verbose(10, "[] -multishift [1|0]:          Flag for shifting non-fractional integer variables by the largest integral amount instead of one unit (default 1 = ON).\n");
+		print_verbose(10, "[] -oneopt [1|0]:              Flag for shifting non-fractional integer variables in a separate 1-opt phase after the rounding (default 0 = OFF).\n");
+		print_verbose(10, "[] -sell [1|0]:                Flag for evaluating the 1-opt candidates in bulk on a sliced ELLPACK (SELL-C-sigma) copy of their columns (default 0 = OFF).\n");
+		print_verbose(10, "[] -colorder [0|1|2]:          Visit order of the fractional columns: 0 = index order, 1 = closest to an integer first, 2 = largest fractionality reduction per unit of slack consumed first (default 0).\n");
+		print_verbose(10, "[] -multistart <pos integer>:  Number of random column orders run in parallel from the same LP solution, keeping the best rounding (default 0 = OFF).\n");
+		print_verbose(10, "[] -components [1|0]:          Flag for rounding the connected components of the row/column graph independently, in parallel (default 0 = OFF).\n");
+		print_verbose(10, "[] -batch <pos integer>:       Number of LP points (solved with different random seeds) rounded in lockstep, keeping the best rounding (default 0 = OFF).\n");
 		print_verbose(10, "[] -maxrounds <pos integer>:   Maximum number of rounds (outer loop executions) performed by ZI-Round (default 0 = OFF).\n");
 		print_verbose(10, "[] -testype <string>:          Text specification of the variant of ZI-Round being tested according to the flags set (user-specified).\n");
 		print_verbose(10, "[] -folder <foldername>:       Input folder. \n");
 		print_verbose(10, "[] -timelimit <seconds>:       Execution time limit in seconds (default 300).\n");
 		print_verbose(10, "[] -rseed <integer>:           Random seed (default -1). \n");
+		print_verbose(10, "[] -stallrounds <pos integer>: Number of consecutive stalled rounds that trigger the stall action (default 0 = OFF).\n");
+		print_verbose(10, "[] -stallfrac <double>:        Minimum fractionality decrease for a round not to be stalled (default 1e-3).\n");
+		print_verbose(10, "[] -stallobj <double>:         Minimum relative objective improvement for a round not to be stalled (default 1e-4).\n");
+		print_verbose(10, "[] -stallaction [0|1|2]:       Action on stall: 0 = monitor only, 1 = stop, 2 = stop shifting non-fractional variables, then stop (default 1).\n");
+		print_verbose(10, "[] -epsstart <double>:         Threshold of the fractional shifts in the first round, tightened every round down to 1e-5 (default 1e-5 = OFF).\n");
+		print_verbose(10, "[] -epsdecay <double>:         Factor applied to the threshold of the fractional shifts after each round (default 0.1).\n");
 		print_verbose(10, "[] -help, --help, -h:          Show help menu.\n");
 		print_verbose(10, "--------------------------------------------------------------------------------\n\n");
 		exit(EXIT_FAILURE);
@@ -0,0 +1,208 @@
+/**
+ * @file components.c
+ * @author Ivan Viviani
+ * @copyright Copyright (c) 2020
+ */
+
+#include "ziround.h"
+
+void component_round(INSTANCE* inst, int* numrounds) {
+
+	INSTANCE* parts;     /**< Views of the instance restricted to groups of components (shared problem data and rounding state). */
+	int* rounds;         /**< Number of rounds performed by each part. */
+	int* comp;           /**< Component of each column. */
+	long long* weight;   /**< Number of nonzeros of the movable columns of each component (one more per column). */
+	long long* key;      /**< Sort keys of the components with movable columns (weight, then index). */
+	long long* load;     /**< Total weight of the components of each part. */
+	int* part_of;        /**< Part of each component (-1 if it has no movable columns). */
+	int* beg;            /**< Begin index of the movable columns of each part in movable (num_parts + 1 entries). */
+	int* movable;        /**< Movable columns grouped by part (in index order within each part). */
+	double* frac_start;  /**< Fractionality of each part at the beginning. */
+	double* delta_up;    /**< Maximum up-shifts, shared by the parts. */
+	double* delta_down;  /**< Maximum down-shifts, shared by the parts. */
+	int num_comps;       /**< Number of components of the instance. */
+	int num_parts;       /**< Number of parts. */
+	int num_toround;     /**< Number of variables to round. */
+	int all_zero;        /**< Flag set to 1 iff the fractionality of every part reached zero. */
+	double obj_start;    /**< Objective value at the beginning. */
+	long long largest;   /**< Largest total weight of a part. */
+	long long total;     /**< Total weight of the parts. */
+
+	// Column orders visit all the columns, so the parts would overlap
+	if ((inst->col_order > 0) || (inst->perm != NULL)) {
+		print_warning("[component_round]: Column orders not supported by the component rounding, whole instance rounded.\n");
+		zi_round(inst, numrounds);
+		return;
+	}
+
+	// Components of the row/column graph
+	comp = (int*)malloc((size_t)max(inst->ncols, 1) * sizeof(int)); if (comp == NULL) print_error("[component_round]: Failed to allocate column components.\n");
+	num_comps = find_components(inst, comp);
+
+	// Weights of the components (only the movable columns are rounded)
+	weight = (long long*)calloc((size_t)max(num_comps, 1), sizeof(long long));
+	key = (long long*)malloc((size_t)max(num_comps, 1) * sizeof(long long));
+	part_of = (int*)malloc((size_t)max(num_comps, 1) * sizeof(int));
+	if (weight == NULL || key == NULL || part_of == NULL) print_error("[component_round]: Failed to allocate component weights.\n");
+	for (int k = 0; k < inst->num_movable; k++) {
+		int j = inst->movable[k];
+		weight[comp[j]] += (long long)(inst->cmatbeg[j + 1] - inst->cmatbeg[j]) + 1;
+	}
+	inst->num_comps = 0;
+	for (int c = 0; c < num_comps; c++) {
+		part_of[c] = -1;
+		if (weight[c] > 0) key[inst->num_comps++] = ((long long)min(weight[c], (long long)INT_MAX) << 32) | c;
+	}
+	print_verbose(10, "[component_round]: %d components, %d with movable columns.\n", num_comps, inst->num_comps);
+
+	// A single component: nothing to split
+	if (inst->num_comps <= 1) {
+		free_all(4, comp, weight, key, part_of);
+		zi_round(inst, numrounds);
+		return;
+	}
+
+	// Longest processing time first: the heaviest components first, each one to the least loaded part
+	num_parts = min(COMPONENT_PARTS, inst->num_comps);
+	load = (long long*)calloc((size_t)num_parts, sizeof(long long)); if (load == NULL) print_error("[component_round]: Failed to allocate part loads.\n");
+	qsort(key, (size_t)inst->num_comps, sizeof(long long), compare_row_keys);
+	for (int a = inst->num_comps - 1; a >= 0; a--) {
+		int c = (int)(key[a] & 0xFFFFFFFF);
+		int p = 0;
+		for (int q = 1; q < num_parts; q++) if (load[q] < load[p]) p = q;
+		part_of[c] = p;
+		load[p] += weight[c];
+	}
+
+	// Movable columns of each part (counting sort, the index order is kept within each part)
+	beg = (int*)calloc((size_t)num_parts + 1, sizeof(int));
+	movable = (int*)malloc((size_t)max(inst->num_movable, 1) * sizeof(int));
+	if (beg == NULL || movable == NULL) print_error("[component_round]: Failed to allocate part columns.\n");
+	for (int k = 0; k < inst->num_movable; k++) beg[part_of[comp[inst->movable[k]]] + 1]++;
+	for (int p = 0; p < num_parts; p++) beg[p + 1] += beg[p];
+	for (int k = 0; k < inst->num_movable; k++) movable[beg[part_of[comp[inst->movable[k]]]]++] = inst->movable[k];
+	for (int p = num_parts; p > 0; p--) beg[p] = beg[p - 1];
+	beg[0] = 0;
+
+	// Global state (the parts share the singletons and the integral rows, each one touches only its own rows)
+	load_singletons(inst);
+	load_integral_rows(inst);
+	inst->objval_comp = 0.0; inst->solfrac_comp = 0.0;
+	inst->solfrac = sol_fractionality(inst->x, inst->int_var, inst->ncols);
+	obj_start = inst->objval;
+
+	// Views of the parts (shallow copies restricted to their movable columns)
+	parts = (INSTANCE*)calloc((size_t)num_parts, sizeof(INSTANCE));
+	rounds = (int*)calloc((size_t)num_parts, sizeof(int));
+	frac_start = (double*)malloc((size_t)num_parts * sizeof(double));
+	delta_up = (double*)malloc((size_t)inst->ncols * sizeof(double));
+	delta_down = (double*)malloc((size_t)inst->ncols * sizeof(double));
+	if (parts == NULL || rounds == NULL || frac_start == NULL || delta_up == NULL || delta_down == NULL) print_error("[component_round]: Failed to allocate parts.\n");
+	for (int p = 0; p < num_parts; p++) {
+		parts[p] = *inst;
+		parts[p].is_part = 1;
+		parts[p].movable = &(movable[beg[p]]);
+		parts[p].num_movable = beg[p + 1] - beg[p];
+		parts[p].part_delta_up = delta_up; parts[p].part_delta_down = delta_down;
+		parts[p].tracker_sol_frac = NULL; parts[p].tracker_sol_cost = NULL; parts[p].tracker_toround = NULL;
+		part_fractionality(&(parts[p]), &num_toround);
+		frac_start[p] = parts[p].solfrac;
+	}
+	largest = 0; total = 0;
+	for (int p = 0; p < num_parts; p++) { largest = max(largest, load[p]); total += load[p]; }
+	print_verbose(10, "[component_round]: %d parts, the largest one with %.1f%% of the movable nonzeros.\n", num_parts, 100.0 * (double)largest / (double)total);
+
+	// Round the parts in parallel (disjoint columns and rows)
+	#pragma omp parallel for schedule(dynamic, 1)
+	for (int p = 0; p < num_parts; p++) {
+		zi_round(&(parts[p]), &(rounds[p]));
+	}
+
+	// Merge the objective and fractionality changes and the statistics of the parts
+	*numrounds = 0;
+	all_zero = 1;
+	inst->zerofrac_round = 0; inst->stall_round = 0; inst->stall_saved = 0;
+	for (int p = 0; p < num_parts; p++) {
+		print_verbose(20, "[component_round]: Part %d: %d columns | solfrac %f | rounds %d\n", p, parts[p].num_movable, parts[p].solfrac, rounds[p]);
+		neumaier_add(&(inst->objval), &(inst->objval_comp), parts[p].objval - obj_start);
+		neumaier_add(&(inst->solfrac), &(inst->solfrac_comp), parts[p].solfrac - frac_start[p]);
+		*numrounds = max(*numrounds, rounds[p]);
+		if (parts[p].zerofrac_round == 0) all_zero = 0;
+		inst->zerofrac_round = max(inst->zerofrac_round, parts[p].zerofrac_round);
+		if ((parts[p].stall_round > 0) && ((inst->stall_round == 0) || (parts[p].stall_round < inst->stall_round))) inst->stall_round = parts[p].stall_round;
+		inst->stall_saved = max(inst->stall_saved, parts[p].stall_saved);
+		free_all(3, parts[p].tracker_sol_frac, parts[p].tracker_sol_cost, parts[p].tracker_toround);
+	}
+	if (!all_zero || !zero(inst->solfrac + inst->solfrac_comp)) inst->zerofrac_round = 0;
+	inst->size_frac = 0; inst->size_cost = 0; inst->size_toround = 0;
+
+	// 1-opt phase, singletons and compensation terms on the whole instance
+	num_toround = inst->num_int_vars - count_rounded(inst->x, inst->ncols, inst->int_var, inst->vartype);
+	print_verbose(10, "* %.3f | %.3f | %d | components *\n", inst->solfrac + inst->solfrac_comp, inst->objval + inst->objval_comp, num_toround);
+	end_rounding(inst, num_toround);
+
+	// Free
+	free_all(12, comp, weight, key, part_of, load, beg, movable, parts, rounds, frac_start, delta_up, delta_down);
+}
+
+int find_components(INSTANCE* inst, int* comp) {
+
+	int* parent;    /**< Parent of each node in the union-find forest (columns first, then rows). */
+	int* label;     /**< Component of each root (-1 if not assigned yet). */
+	COL_ITER col;   /**< Iterator over the constraints containing the current variable. */
+	int rowind;     /**< Current row index. */
+	double aij;     /**< Current constraint coefficient (unused). */
+	int root_j;     /**< Root of the current column. */
+	int root_i;     /**< Root of the current row. */
+	int num_comps;  /**< Number of components. */
+
+	// Allocate
+	parent = (int*)malloc(((size_t)inst->ncols + inst->nrows) * sizeof(int));
+	label = (int*)malloc(((size_t)inst->ncols + inst->nrows) * sizeof(int));
+	if (parent == NULL || label == NULL) print_error("[find_components]: Failed to allocate union-find forest.\n");
+	for (int v = 0; v < inst->ncols + inst->nrows; v++) { parent[v] = v; label[v] = -1; }
+
+	// Join each column with its rows (the smaller root becomes the parent)
+	for (int j = 0; j < inst->ncols; j++) {
+		for (col_begin(inst, j, &col); col_next(&col, &rowind, &aij); ) {
+			root_j = uf_find(parent, j);
+			root_i = uf_find(parent, inst->ncols + rowind);
+			if (root_j < root_i) parent[root_i] = root_j;
+			else if (root_i < root_j) parent[root_j] = root_i;
+		}
+	}
+
+	// Number the components in the order of their first column
+	num_comps = 0;
+	for (int j = 0; j < inst->ncols; j++) {
+		root_j = uf_find(parent, j);
+		if (label[root_j] < 0) label[root_j] = num_comps++;
+		comp[j] = label[root_j];
+	}
+
+	// Free
+	free_all(2, parent, label);
+
+	return num_comps;
+}
+
+int uf_find(int* parent, int v) {
+
+	// Path halving
+	while (parent[v] != v) {
+		parent[v] = parent[parent[v]];
+		v = parent[v];
+	}
+
+	return v;
+}
+
+void part_fractionality(INSTANCE* part, int* num_toround) {
+
+	part->solfrac = 0.0;
+	*num_toround = 0;
+	for (int k = 0; k < part->num_movable; k++) {
+		part->solfrac += fractionality(part->x[part->movable[k]]);
+		*num_toround += is_fractional(part->x[part->movable[k]]);
+	}
+}
@@ -0,0 +1,117 @@
+/**
+ * @file compress.c
+ * @author Ivan Viviani
+ * @copyright Copyright (c) 2020
+ */
+
+#include "ziround.h"
+
+void compress_columns(INSTANCE* inst) {
+
+	double* values;     /**< Sorted distinct coefficients of the matrix. */
+	int num_values;     /**< Number of distinct coefficients. */
+	unsigned char* out; /**< Next byte of the compressed columns. */
+	size_t size;        /**< Size in bytes of the compressed columns. */
+	nzind_t colend;     /**< Index of the last constraint containing the current variable. */
+	int prev;           /**< Row index of the previous nonzero of the column. */
+	unsigned int z;     /**< Zigzag encoding of the current row index delta. */
+	double* code;       /**< Dictionary entry of the current coefficient. */
+
+	if (!(inst->compress_csc)) return;
+	if (inst->store.view != NULL) {
+		print_warning("[compress_columns]: Compressed columns not supported with the memory-mapped store, ignored.\n");
+		return;
+	}
+
+	// Coefficient dictionary: distinct values of the matrix (if not more than CSC_DICT_MAX)
+	values = (double*)malloc((size_t)inst->nzcnt * sizeof(double)); if (values == NULL) print_error("[compress_columns]: Failed to allocate coefficients.\n");
+	memcpy(values, inst->cmatval, (size_t)inst->nzcnt * sizeof(double));
+	qsort(values, (size_t)inst->nzcnt, sizeof(double), compare_double);
+	num_values = 1;
+	for (nzind_t k = 1; k < inst->nzcnt; k++) {
+		if (values[k] != values[num_values - 1]) {
+			if (num_values == CSC_DICT_MAX) { num_values = CSC_DICT_MAX + 1; break; }
+			values[num_values++] = values[k];
+		}
+	}
+	if (num_values <= CSC_DICT_MAX) {
+		inst->cmatdict = (double*)realloc(values, num_values * sizeof(double)); if (inst->cmatdict == NULL) print_error("[compress_columns]: Failed to allocate coefficient dictionary.\n");
+		inst->dictsize = num_values;
+	}
+	else free(values);
+
+	// Column streams: zigzag varint of the row index deltas, each followed by the dictionary code of the coefficient
+	inst->cmatpos = (size_t*)malloc(((size_t)inst->ncols + 1) * sizeof(size_t));
+	inst->cmatcode = (unsigned char*)malloc((size_t)inst->nzcnt * (CSC_VARINT_MAX + 1) * sizeof(unsigned char));
+	if (inst->cmatpos == NULL || inst->cmatcode == NULL) print_error("[compress_columns]: Failed to allocate compressed columns.\n");
+	out = inst->cmatcode;
+	for (int j = 0; j < inst->ncols; j++) {
+
+		inst->cmatpos[j] = (size_t)(out - inst->cmatcode);
+		prev = 0;
+		colend = inst->cmatbeg[j + 1];
+		for (nzind_t k = inst->cmatbeg[j]; k < colend; k++) {
+
+			z = ((unsigned int)(inst->cmatind[k] - prev) << 1) ^ (unsigned int)((inst->cmatind[k] - prev) >> 31);
+			while (z >= 0x80) { *(out++) = (unsigned char)(z | 0x80); z >>= 7; }
+			*(out++) = (unsigned char)z;
+			prev = inst->cmatind[k];
+
+			if (inst->cmatdict != NULL) {
+				code = (double*)bsearch(&(inst->cmatval[k]), inst->cmatdict, inst->dictsize, sizeof(double), compare_double);
+				assert(code != NULL);
+				*(out++) = (unsigned char)(code - inst->cmatdict);
+			}
+		}
+	}
+	size = (size_t)(out - inst->cmatcode);
+	inst->cmatpos[inst->ncols] = size;
+	out = (unsigned char*)realloc(inst->cmatcode, max(size, 1) * sizeof(unsigned char)); if (out == NULL) print_error("[compress_columns]: Failed to shrink compressed columns.\n");
+	inst->cmatcode = out;
+
+	// The row indices (and the coefficients, if coded) are read from the streams only
+	free(inst->cmatind); inst->cmatind = NULL;
+	if (inst->cmatdict != NULL) { free(inst->cmatval); inst->cmatval = NULL; }
+
+	print_verbose(20, "[compress_columns]: Columns compressed to %.2f bytes per nonzero (%s).\n",
+		(double)size / (double)inst->nzcnt, (inst->cmatdict != NULL) ? "with coefficient dictionary" : "plain coefficients");
+}
+
+void narrow_coefficients(INSTANCE* inst) {
+
+	COL_ITER col;   /**< Iterator over the constraints containing the current variable. */
+	int rowind;     /**< Current row index. */
+	double aij;     /**< Current constraint coefficient. */
+	float* flt;     /**< Single precision coefficients (column major). */
+	int exact;      /**< Flag set to 1 iff all the coefficients are exact in single precision. */
+
+	if (!(inst->mixed_precision)) return;
+	if (inst->store.view != NULL || inst->cmatval == NULL) {
+		print_warning("[narrow_coefficients]: Single precision coefficients not used (memory-mapped store or coefficient dictionary).\n");
+		return;
+	}
+
+	// Allocate
+	flt = (float*)malloc((size_t)inst->nzcnt * sizeof(float)); if (flt == NULL) print_error("[narrow_coefficients]: Failed to allocate single precision coefficients.\n");
+
+	// Single precision coefficients, kept only if all of them are exact (then the double coefficients are reproduced bit by bit).
+	// No row scaling: a power of two scale only changes the exponent, so it cannot make a coefficient exact
+	exact = 1;
+	for (int j = 0; j < inst->ncols && exact; j++) {
+		for (col_begin(inst, j, &col); col_next(&col, &rowind, &aij); ) {
+			flt[col.k - 1] = (float)aij;
+			if ((double)(flt[col.k - 1]) != aij) { exact = 0; break; }
+		}
+	}
+	if (!exact) {
+		print_warning("[narrow_coefficients]: Some coefficients are not exact in single precision, double precision used.\n");
+		free(flt);
+		return;
+	}
+
+	// The double coefficients are no longer needed (the iterator widens the single precision ones)
+	inst->cmatflt = flt;
+	free(inst->cmatval); inst->cmatval = NULL;
+
+	print_verbose(20, "[narrow_coefficients]: Coefficients stored in single precision.\n");
+}
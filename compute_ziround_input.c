@@ -74,4 +74,33 @@ void solve_continuous_relaxation(INSTANCE* inst) {
 
 	if (CPXchgprobtype(inst->env, inst->lp, CPXPROB_LP)) print_error("[solve_continuous_relaxation]: Failed to change problem type.\n");
 	if (CPXlpopt(inst->env, inst->lp)) print_error("[solve_continuous_relaxation]: Failed to optimize LP.\n");
+}
+
+// [EXTENSION]
+void solve_batch_relaxations(INSTANCE* inst) {
+
+	double* point; /**< Current LP point. */
+	int seed;      /**< Random seed of the current solve. */
+
+	// Allocate LP points (the first one is the current LP solution)
+	inst->batch_x = (double*)malloc((size_t)inst->batch_size * inst->ncols * sizeof(double)); if (inst->batch_x == NULL) print_error("[solve_batch_relaxations]: Failed to allocate LP points.\n");
+	memcpy(inst->batch_x, inst->x, inst->ncols * sizeof(double));
+
+	// Solve from scratch (no advanced start), otherwise the same basis is found again
+	if (CPXsetintparam(inst->env, CPXPARAM_Advance, 0)) print_warning("[solve_batch_relaxations]: Failed to disable advanced start.\n");
+
+	for (int s = 1; s < inst->batch_size; s++) {
+
+		point = &(inst->batch_x[(size_t)s * inst->ncols]);
+		seed = ((inst->rseed >= 0) ? inst->rseed : 0) + s;
+
+		if (CPXsetintparam(inst->env, CPXPARAM_RandomSeed, seed)) print_warning("[solve_batch_relaxations]: Failed to set random seed to %d.\n", seed);
+		if (CPXlpopt(inst->env, inst->lp) || (CPXgetstat(inst->env, inst->lp) != CPX_STAT_OPTIMAL) || CPXgetx(inst->env, inst->lp, point, 0, inst->ncols - 1)) {
+			print_warning("[solve_batch_relaxations]: LP solve with seed %d failed, using the first LP point.\n", seed);
+			memcpy(point, inst->x, inst->ncols * sizeof(double));
+		}
+	}
+
+	// Restore the random seed
+	if ((inst->rseed >= 0) && CPXsetintparam(inst->env, CPXPARAM_RandomSeed, inst->rseed)) print_warning("[solve_batch_relaxations]: Failed to restore random seed to %d.\n", inst->rseed);
 }
\ No newline at end of file
@@ -10,7 +10,7 @@ void init_inst(INSTANCE* inst) {
 	
 	inst->x                = NULL;    inst->obj              = NULL;
 	inst->lb               = NULL;    inst->ub               = NULL;
-	inst->slack            = NULL;    inst->vartype          = NULL;
+	inst->rows             = NULL;    inst->vartype          = NULL;
 	inst->int_var          = NULL;    inst->row_singletons   = NULL;
 	inst->num_singletons   = NULL;    inst->rs_beg           = NULL;
 	inst->rs_coef          = NULL;    inst->ss_val           = NULL;
@@ -27,6 +27,44 @@ void init_inst(INSTANCE* inst) {
 	inst->sort_singletons  = 0;       inst->after0frac       = 0;
 	inst->max_rounds       = 0;       inst->fractie_worstobj = 0;
 	inst->timelimit        = 300;     inst->rseed            = -1;
+	inst->stall_rounds     = 0;       inst->stall_frac       = 1e-3;
+	inst->stall_obj        = 1e-4;    inst->stall_action     = 1;
+	inst->stall_round      = 0;       inst->stall_saved      = 0;
+	inst->eps_start        = EPSILON; inst->eps_decay        = 0.1;
+	inst->multi_shift      = 1;       inst->one_opt          = 0;
+	inst->oneopt_shifts    = 0;       inst->oneopt_evals     = 0;
+	inst->col_order        = 0;       inst->zerofrac_round   = 0;
+	inst->perm             = NULL;    inst->num_starts       = 0;
+	inst->ms_best          = 0;       inst->ms_feasible      = 0;
+	inst->batch_x          = NULL;    inst->batch_size       = 0;
+	inst->batch_best       = 0;       inst->movable          = NULL;
+	inst->num_movable      = 0;       inst->lazy_singletons  = 0;
+	inst->rs_skip_inc      = NULL;    inst->rs_skip_dec      = NULL;
+	inst->rs_rec           = NULL;    inst->csc_only         = 0;
+	inst->mmap_store       = 0;       inst->store.view       = NULL;
+	inst->store.file       = NULL;    inst->store.mapping    = NULL;
+	inst->store.size       = 0;       inst->store.used       = 0;
+	inst->compress_csc     = 0;       inst->cmatcode         = NULL;
+	inst->cmatpos          = NULL;    inst->cmatdict         = NULL;
+	inst->dictsize         = 0;       inst->mixed_precision  = 0;
+	inst->cmatflt          = NULL;
+	inst->int_rows         = 0;       inst->int_act          = NULL;
+	inst->num_nonint       = NULL;    inst->x_int            = NULL;
+	inst->objval_comp      = 0.0;     inst->solfrac_comp     = 0.0;
+	inst->resync_rounds    = 0;       inst->rcm              = 0;
+	inst->row_orig         = NULL;
+	inst->sell_oneopt      = 0;       inst->components       = 0;
+	inst->is_part          = 0;       inst->num_comps        = 0;
+	inst->part_delta_up    = NULL;    inst->part_delta_down  = NULL;
+	inst->sell.col         = NULL;    inst->sell.len         = NULL;
+	inst->sell.beg         = NULL;    inst->sell.ind         = NULL;
+	inst->sell.val         = NULL;    inst->sell.room_up     = NULL;
+	inst->sell.room_down   = NULL;    inst->sell.exact       = NULL;
+	inst->sell.num_chunks  = 0;
+	inst->presolve         = 0;       inst->pre.orig_lp      = NULL;
+	inst->pre.colmap       = NULL;    inst->pre.fixval       = NULL;
+	inst->pre.x            = NULL;    inst->pre.obj_offset   = 0.0;
+	inst->pre.ncols        = 0;       inst->pre.nrows        = 0;
 	strcpy(inst->input_file, "NULL"); strcpy(inst->input_folder, "NULL");
 }
 
@@ -35,14 +73,31 @@ void free_inst(INSTANCE* inst) {
 	char* errmsg = (char*)malloc(CPXMESSAGEBUFSIZE * sizeof(char)); if (errmsg == NULL) print_error("[setup_CPLEX_env]: Failed to allocate errmsg.\n");
 	int status = 0;
 	
-	free_all(25, 
-		inst->x,       inst->obj,     inst->lb,               inst->ub,               inst->slack,          
+	// [EXTENSION] Arrays in the memory-mapped store (set to NULL)
+	close_store(inst);
+
+	free_all(37, 
+		inst->x,       inst->obj,     inst->lb,               inst->ub,               inst->rows,          
 		inst->vartype, inst->int_var, inst->row_singletons,   inst->num_singletons,   inst->rs_beg,  
 		inst->rs_coef, inst->ss_val,  inst->ss_ub,            inst->ss_lb,            inst->rmatbeg, 
 		inst->rmatind, inst->rmatval, inst->cmatbeg,          inst->cmatind,          inst->cmatval, 
-		inst->sense,   inst->rhs,     inst->tracker_sol_frac, inst->tracker_sol_cost, inst->tracker_toround
+		inst->sense,   inst->rhs,     inst->tracker_sol_frac, inst->tracker_sol_cost, inst->tracker_toround,
+		inst->batch_x, inst->movable, inst->rs_skip_inc, inst->rs_skip_dec, inst->rs_rec,
+		inst->cmatcode, inst->cmatpos, inst->cmatdict, inst->cmatflt,
+		inst->pre.colmap, inst->pre.fixval, inst->pre.x
 	);
 
+	// [EXTENSION] Sliced ELLPACK copy of the 1-opt candidates
+	sell_free(&(inst->sell));
+
+	// [EXTENSION] Original row indices
+	free(inst->row_orig);
+
+	// [EXTENSION] Original problem kept for the postsolve
+	if (inst->pre.orig_lp != NULL) {
+		if (CPXfreeprob(inst->env, &(inst->pre.orig_lp))) print_error("[free_inst]: CPXfreeprob failed on the original problem.\n");
+	}
+
 	if (inst->lp != NULL) {
 		if (CPXfreeprob(inst->env, &(inst->lp))) print_error("[free_inst]: CPXfreeprob failed, error code %d.\n", status);
 	}
@@ -57,4 +112,69 @@ void free_inst(INSTANCE* inst) {
 
 	// Free
 	free(errmsg);
+}
+
+void clone_inst(INSTANCE* clone, INSTANCE* inst) {
+
+	// Share the problem data (shallow copy)
+	*clone = *inst;
+
+	// Private copies of the rounding state
+	clone->x = (double*)malloc(inst->ncols * sizeof(double));
+	clone->rows = (ROW_STATE*)malloc(inst->nrows * sizeof(ROW_STATE)); if (clone->x == NULL || clone->rows == NULL) print_error("[clone_inst]: Failed to allocate clone state.\n");
+	memcpy(clone->x, inst->x, inst->ncols * sizeof(double));
+	memcpy(clone->rows, inst->rows, inst->nrows * sizeof(ROW_STATE));
+	if (inst->ss_val != NULL) {
+		clone->ss_val = (double*)malloc(inst->nrows * sizeof(double)); if (clone->ss_val == NULL) print_error("[clone_inst]: Failed to allocate clone singletons slacks.\n");
+		memcpy(clone->ss_val, inst->ss_val, inst->nrows * sizeof(double));
+	}
+	if (inst->rs_skip_inc != NULL) {
+		clone->rs_skip_inc = (int*)malloc(inst->nrows * sizeof(int));
+		clone->rs_skip_dec = (int*)malloc(inst->nrows * sizeof(int)); if (clone->rs_skip_inc == NULL || clone->rs_skip_dec == NULL) print_error("[clone_inst]: Failed to allocate clone singletons skip pointers.\n");
+		memcpy(clone->rs_skip_inc, inst->rs_skip_inc, inst->nrows * sizeof(int));
+		memcpy(clone->rs_skip_dec, inst->rs_skip_dec, inst->nrows * sizeof(int));
+	}
+	if (inst->rs_rec != NULL) {
+		clone->rs_rec = (SINGLETON*)malloc(max(inst->rs_size, 1) * sizeof(SINGLETON)); if (clone->rs_rec == NULL) print_error("[clone_inst]: Failed to allocate clone singleton records.\n");
+		memcpy(clone->rs_rec, inst->rs_rec, inst->rs_size * sizeof(SINGLETON));
+	}
+	clone->perm = NULL;
+	clone->tracker_sol_frac = NULL; clone->tracker_sol_cost = NULL; clone->tracker_toround = NULL;
+	clone->env = NULL; clone->lp = NULL;
+}
+
+void copy_inst_state(INSTANCE* inst, INSTANCE* clone) {
+
+	// Rounding state
+	memcpy(inst->x, clone->x, inst->ncols * sizeof(double));
+	memcpy(inst->rows, clone->rows, inst->nrows * sizeof(ROW_STATE));
+	if (inst->ss_val != NULL) memcpy(inst->ss_val, clone->ss_val, inst->nrows * sizeof(double));
+	if (inst->rs_skip_inc != NULL) {
+		memcpy(inst->rs_skip_inc, clone->rs_skip_inc, inst->nrows * sizeof(int));
+		memcpy(inst->rs_skip_dec, clone->rs_skip_dec, inst->nrows * sizeof(int));
+	}
+	if (inst->rs_rec != NULL) memcpy(inst->rs_rec, clone->rs_rec, inst->rs_size * sizeof(SINGLETON));
+	inst->objval = clone->objval;
+	inst->solfrac = clone->solfrac;
+
+	// Statistics
+	inst->stall_round = clone->stall_round;
+	inst->stall_saved = clone->stall_saved;
+	inst->oneopt_shifts = clone->oneopt_shifts;
+	inst->oneopt_evals = clone->oneopt_evals;
+	inst->zerofrac_round = clone->zerofrac_round;
+
+	// Trackers (moved)
+	free_all(3, inst->tracker_sol_frac, inst->tracker_sol_cost, inst->tracker_toround);
+	inst->tracker_sol_frac = clone->tracker_sol_frac; inst->size_frac = clone->size_frac; inst->len_frac = clone->len_frac;
+	inst->tracker_sol_cost = clone->tracker_sol_cost; inst->size_cost = clone->size_cost; inst->len_cost = clone->len_cost;
+	inst->tracker_toround = clone->tracker_toround; inst->size_toround = clone->size_toround; inst->len_toround = clone->len_toround;
+	clone->tracker_sol_frac = NULL; clone->tracker_sol_cost = NULL; clone->tracker_toround = NULL;
+}
+
+void free_clone(INSTANCE* clone) {
+
+	free_all(10, clone->x, clone->rows, clone->ss_val, clone->rs_skip_inc, clone->rs_skip_dec, clone->rs_rec, clone->perm, clone->tracker_sol_frac, clone->tracker_sol_cost, clone->tracker_toround);
+	clone->x = NULL; clone->rows = NULL; clone->ss_val = NULL; clone->rs_skip_inc = NULL; clone->rs_skip_dec = NULL; clone->rs_rec = NULL; clone->perm = NULL;
+	clone->tracker_sol_frac = NULL; clone->tracker_sol_cost = NULL; clone->tracker_toround = NULL;
 }
\ No newline at end of file
@@ -41,6 +41,7 @@ void test_instance(INSTANCE* inst) {
 		
 	setup_CPLEX_env(inst);
 	read_MIP_problem(inst, inst->input_file);
+	presolve(inst);
 	save_integer_variables(inst);
 	
 	// Measure execution time (in milliseconds) for solving the continuous relaxation (time limit of 5 minutes)
@@ -52,25 +53,42 @@ void test_instance(INSTANCE* inst) {
 
 	populate_inst(inst);
 
+	// [EXTENSION] Solve again for the additional LP points of the batched rounding (added to the LP solve time)
+	if (inst->batch_size > 0) {
+		QueryPerformanceCounter(&lpstart);
+		solve_batch_relaxations(inst);
+		QueryPerformanceCounter(&lpend);
+		lp_solve_exec_time += (lpend.QuadPart - lpstart.QuadPart) * 1000 / lpfreq.QuadPart;
+	}
+
 	// Measure execution time (in milliseconds) of ZI-Round
 	QueryPerformanceFrequency(&zifreq);
 	QueryPerformanceCounter(&zistart);
-	zi_round(inst, &numrounds);
+	if (inst->batch_size > 0) batch_round(inst, &numrounds);
+	else if (inst->num_starts > 0) multi_start(inst, &numrounds);
+	else if (inst->components) component_round(inst, &numrounds);
+	else zi_round(inst, &numrounds);
 	QueryPerformanceCounter(&ziend);
 	ziround_exec_time = (ziend.QuadPart - zistart.QuadPart) * 1000 / zifreq.QuadPart;
 
 	print_verbose(10, "[INFO]: ZI-Round terminated. #Rounds: %d\n", numrounds);
+	if (inst->stall_rounds > 0) print_verbose(10, "[INFO]: Stall rule fired at round: %d (rounds saved in monitor mode: %d)\n", inst->stall_round, inst->stall_saved);
+	print_verbose(10, "[INFO]: Zero fractionality reached at round: %d\n", inst->zerofrac_round);
+	if (inst->batch_size > 0) print_verbose(10, "[INFO]: Batched rounding: best LP point %d of %d\n", inst->batch_best, inst->batch_size);
+	if (inst->num_starts > 0) print_verbose(10, "[INFO]: Multi-start: best start %d of %d (%d reached zero fractionality)\n", inst->ms_best, inst->num_starts, inst->ms_feasible);
+	if (inst->components) print_verbose(10, "[INFO]: Connected components with movable columns: %d\n", inst->num_comps);
+	if (inst->one_opt) print_verbose(10, "[INFO]: 1-opt shifts: %d (gain evaluations: %d)\n", inst->oneopt_shifts, inst->oneopt_evals);
 	print_verbose(10, "[INFO]: LP solve execution time (in milliseconds): %lld ms\n", lp_solve_exec_time);
 	print_verbose(10, "[INFO]: ZI-Round execution time (in milliseconds): %lld ms\n", ziround_exec_time);
 	print_verbose(10, "[INFO]: Sum of LP solve + ZI-Round execution time (in milliseconds): %lld ms\n", lp_solve_exec_time + ziround_exec_time);
 	assert(equals(inst->solfrac, sol_fractionality(inst->x, inst->int_var, inst->ncols)));
-	assert(equals(inst->objval, dot_product(inst->obj, inst->x, inst->ncols)));
+	assert(fabs(inst->objval - dot_product(inst->obj, inst->x, inst->ncols)) <= TOLERANCE * max(1.0, fabs(inst->objval)));
 	print_verbose(10, "[INFO]: Solution fractionality: %f\n", inst->solfrac);
 	print_verbose(20, "[INFO]: Candidate objective value: %f\n", inst->objval);
 	
 	check_bounds(inst->x, inst->lb, inst->ub, inst->ncols);
-	check_constraints(inst->x, inst->ncols, inst->nrows, inst->nzcnt, inst->rmatbeg,
-		inst->rmatind, inst->rmatval, inst->sense, inst->rhs);
+	check_inst_constraints(inst);
+	postsolve(inst);
 
 	if (VERBOSE >= 10) plot(inst);
 
@@ -106,7 +124,7 @@ void test_folder(INSTANCE* inst, const char* test_type) {
 
 	// Print file headers
 	FILE* output = fopen(output_path, "a");
-	fprintf(output, "Instance;Seed;Cost;Fractionality;Rounds;LPtime(ms);ZItime(ms);SumLPZI(ms)\n");
+	fprintf(output, "Instance;Seed;Cost;Fractionality;Rounds;LPtime(ms);ZItime(ms);SumLPZI(ms);StallRound;StallSaved;OneOptShifts;ZeroFracRound;MSFeasible;ScanCut(%%)\n");
 	fclose(output);
 
 	// Scan files
@@ -123,11 +141,33 @@ void test_folder(INSTANCE* inst, const char* test_type) {
 		test_inst.singletons = inst->singletons;
 		test_inst.shift_nonfracvars = inst->shift_nonfracvars;
 		test_inst.sort_singletons = inst->sort_singletons;
+		test_inst.lazy_singletons = inst->lazy_singletons;
+		test_inst.csc_only = inst->csc_only;
+		test_inst.mmap_store = inst->mmap_store;
+		test_inst.compress_csc = inst->compress_csc;
+		test_inst.mixed_precision = inst->mixed_precision;
+		test_inst.int_rows = inst->int_rows;
+		test_inst.resync_rounds = inst->resync_rounds;
+		test_inst.rcm = inst->rcm;
+		test_inst.presolve = inst->presolve;
+		test_inst.sell_oneopt = inst->sell_oneopt;
+		test_inst.components = inst->components;
 		test_inst.after0frac = inst->after0frac;
+		test_inst.multi_shift = inst->multi_shift;
+		test_inst.one_opt = inst->one_opt;
+		test_inst.col_order = inst->col_order;
+		test_inst.num_starts = inst->num_starts;
+		test_inst.batch_size = inst->batch_size;
 		test_inst.max_rounds = inst->max_rounds;
 		test_inst.fractie_worstobj = inst->fractie_worstobj;
 		test_inst.timelimit = inst->timelimit;
 		test_inst.rseed = inst->rseed;
+		test_inst.stall_rounds = inst->stall_rounds;
+		test_inst.stall_frac = inst->stall_frac;
+		test_inst.stall_obj = inst->stall_obj;
+		test_inst.stall_action = inst->stall_action;
+		test_inst.eps_start = inst->eps_start;
+		test_inst.eps_decay = inst->eps_decay;
 
 		print_verbose(10, "TEST INSTANCE ------------------------------------------------------------------\n");
 		print_verbose(1,  "[%d] Instance name: %s\n", ++count, test_inst.input_file);
@@ -138,6 +178,7 @@ void test_folder(INSTANCE* inst, const char* test_type) {
 
 		setup_CPLEX_env(&test_inst);
 		read_MIP_problem(&test_inst, test_inst.input_file);
+		presolve(&test_inst);
 		save_integer_variables(&test_inst);
 
 		// Measure execution time (in milliseconds) for solving the continuous relaxation (time limit of 5 minutes)
@@ -149,22 +190,36 @@ void test_folder(INSTANCE* inst, const char* test_type) {
 
 		populate_inst(&test_inst);
 
+		// [EXTENSION] Solve again for the additional LP points of the batched rounding (added to the LP solve time)
+		if (test_inst.batch_size > 0) {
+			QueryPerformanceCounter(&lpstart);
+			solve_batch_relaxations(&test_inst);
+			QueryPerformanceCounter(&lpend);
+			lp_solve_exec_time += (lpend.QuadPart - lpstart.QuadPart) * 1000 / lpfreq.QuadPart;
+		}
+
 		// Measure execution time (in milliseconds) of ZI-Round
 		QueryPerformanceFrequency(&zifreq);
 		QueryPerformanceCounter(&zistart);
-		zi_round(&test_inst, &numrounds);
+		if (test_inst.batch_size > 0) batch_round(&test_inst, &numrounds);
+		else if (test_inst.num_starts > 0) multi_start(&test_inst, &numrounds);
+		else if (test_inst.components) component_round(&test_inst, &numrounds);
+		else zi_round(&test_inst, &numrounds);
 		QueryPerformanceCounter(&ziend);
 		ziround_exec_time = (ziend.QuadPart - zistart.QuadPart) * 1000 / zifreq.QuadPart;
 
-		assert(fabs(test_inst.solfrac - sol_fractionality(test_inst.x, test_inst.int_var, test_inst.ncols)) < 0.01);
-		assert(fabs(test_inst.objval - dot_product(test_inst.obj, test_inst.x, test_inst.ncols)) < test_inst.objval / 10000);
+		assert(equals(test_inst.solfrac, sol_fractionality(test_inst.x, test_inst.int_var, test_inst.ncols)));
+		assert(fabs(test_inst.objval - dot_product(test_inst.obj, test_inst.x, test_inst.ncols)) <= TOLERANCE * max(1.0, fabs(test_inst.objval)));
 		check_bounds(test_inst.x, test_inst.lb, test_inst.ub, test_inst.ncols);
-		check_constraints(test_inst.x, test_inst.ncols, test_inst.nrows, test_inst.nzcnt, test_inst.rmatbeg, test_inst.rmatind, test_inst.rmatval, test_inst.sense, test_inst.rhs);
+		check_inst_constraints(&test_inst);
+		postsolve(&test_inst);
 
 		// Print test results to file
 		output = fopen(output_path, "a");
-		fprintf(output, "%s;%d;%f;%f;%d;%lld;%lld;%lld\n", 
-			strtok(direlem->d_name, "."), test_inst.rseed, test_inst.objval, test_inst.solfrac, numrounds, lp_solve_exec_time, ziround_exec_time, lp_solve_exec_time + ziround_exec_time);
+		fprintf(output, "%s;%d;%f;%f;%d;%lld;%lld;%lld;%d;%d;%d;%d;%d;%.2f\n", 
+			strtok(direlem->d_name, "."), test_inst.rseed, test_inst.objval, test_inst.solfrac, numrounds, lp_solve_exec_time, ziround_exec_time, lp_solve_exec_time + ziround_exec_time,
+			test_inst.stall_round, test_inst.stall_saved, test_inst.oneopt_shifts, test_inst.zerofrac_round, test_inst.ms_feasible,
+			100.0 * (test_inst.ncols - test_inst.num_movable) / test_inst.ncols);
 		fclose(output);
 
 		print_verbose(10, "TEST RESULT --------------------------------------------------------------------\n");
@@ -173,6 +228,12 @@ void test_folder(INSTANCE* inst, const char* test_type) {
 		print_verbose(10, "[] LP solve execution time (in milliseconds): %lld ms\n", lp_solve_exec_time);
 		print_verbose(10, "[] ZI-Round execution time (in milliseconds): %lld ms\n", ziround_exec_time);
 		print_verbose(10, "[] Sum of LP solve + ZI-Round execution time (in milliseconds): %lld ms\n", lp_solve_exec_time + ziround_exec_time);
+		print_verbose(10, "[] Stall rule fired at round: %d (rounds saved in monitor mode: %d)\n", test_inst.stall_round, test_inst.stall_saved);
+		print_verbose(10, "[] Zero fractionality reached at round: %d\n", test_inst.zerofrac_round);
+		print_verbose(10, "[] Batched rounding: best LP point %d of %d\n", test_inst.batch_best, test_inst.batch_size);
+		print_verbose(10, "[] Multi-start: best start %d of %d (%d reached zero fractionality)\n", test_inst.ms_best, test_inst.num_starts, test_inst.ms_feasible);
+		print_verbose(10, "[] Connected components with movable columns: %d\n", test_inst.num_comps);
+		print_verbose(10, "[] 1-opt shifts: %d (gain evaluations: %d)\n", test_inst.oneopt_shifts, test_inst.oneopt_evals);
 		print_verbose(10, "--------------------------------------------------------------------------------\n\n\n");
 
 		free_inst(&test_inst);
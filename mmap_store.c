@@ -0,0 +1,101 @@
+/**
+ * @file mmap_store.c
+ * @author Ivan Viviani
+ * @copyright Copyright (c) 2020
+ */
+
+#include "ziround.h"
+
+void open_store(INSTANCE* inst) {
+
+	STORE* store;       /**< Store of the instance. */
+	nzind_t nzcnt;      /**< Number of non-zero coefficients of the matrix. */
+	char dir[MAX_PATH]; /**< Folder of the temporary files. */
+
+	if (!(inst->mmap_store)) return;
+	store = &(inst->store);
+
+	// Size of the store: column begin indices, row indices and coefficients of the matrix, objective, bounds and types
+	nzcnt = ZI_getnumnz(inst->env, inst->lp);
+	assert(nzcnt > 0);
+	store->size = store_section((size_t)(inst->ncols + 1) * sizeof(nzind_t))
+		+ store_section((size_t)nzcnt * sizeof(int)) + store_section((size_t)nzcnt * sizeof(double))
+		+ 3 * store_section((size_t)inst->ncols * sizeof(double)) + store_section((size_t)inst->ncols * sizeof(char));
+	store->used = 0;
+
+	// Create the backing file (read sequentially by column) and map it
+	if (!GetTempPathA(MAX_PATH, dir) || !GetTempFileNameA(dir, "zim", 0, store->path)) print_error("[open_store]: Failed to create the name of the store file.\n");
+	store->file = CreateFileA(store->path, GENERIC_READ | GENERIC_WRITE, 0, NULL, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+	if (store->file == INVALID_HANDLE_VALUE) print_error("[open_store]: Failed to create the store file %s (error %lu).\n", store->path, GetLastError());
+	store->mapping = CreateFileMappingA(store->file, NULL, PAGE_READWRITE, (DWORD)((unsigned long long)store->size >> 32), (DWORD)(store->size & 0xFFFFFFFF), NULL);
+	if (store->mapping == NULL) print_error("[open_store]: Failed to map the store file %s (error %lu).\n", store->path, GetLastError());
+	store->view = (char*)MapViewOfFile(store->mapping, FILE_MAP_ALL_ACCESS, 0, 0, 0);
+	if (store->view == NULL) print_error("[open_store]: Failed to map a view of the store file %s (error %lu).\n", store->path, GetLastError());
+
+	// The row view would take the same memory as the mapped matrix: keep the matrix by columns only
+	inst->csc_only = 1;
+
+	print_verbose(20, "[open_store]: Column data mapped from %s (%.1f MB).\n", store->path, (double)store->size / (1024.0 * 1024.0));
+}
+
+void* store_alloc(INSTANCE* inst, size_t size) {
+
+	void* ptr; /**< Allocated memory. */
+
+	// Store disabled: allocate in memory
+	if (inst->store.view == NULL) return malloc(size);
+
+	// Next section of the store
+	if (inst->store.used + store_section(size) > inst->store.size) print_error("[store_alloc]: Store full (%zu + %zu > %zu bytes).\n", inst->store.used, size, inst->store.size);
+	ptr = inst->store.view + inst->store.used;
+	inst->store.used += store_section(size);
+
+	return ptr;
+}
+
+void finalize_store(INSTANCE* inst) {
+
+	char* vartype;                       /**< Variable types in the store. */
+	WIN32_MEMORY_RANGE_ENTRY ranges[4];  /**< Per-column data to keep resident. */
+
+	if (inst->store.view == NULL) return;
+
+	// Move the variable types (read before the store was opened) into the store
+	vartype = (char*)store_alloc(inst, (size_t)inst->ncols * sizeof(char));
+	memcpy(vartype, inst->vartype, (size_t)inst->ncols * sizeof(char));
+	free(inst->vartype);
+	inst->vartype = vartype;
+
+	// Access hints: the nonzeros are streamed column by column (sequential scan flag of the file), while
+	// the per-column data (begin indices, objective, bounds) is read at every column visit and is prefetched
+	ranges[0].VirtualAddress = inst->cmatbeg; ranges[0].NumberOfBytes = (size_t)(inst->ncols + 1) * sizeof(nzind_t);
+	ranges[1].VirtualAddress = inst->obj;     ranges[1].NumberOfBytes = (size_t)inst->ncols * sizeof(double);
+	ranges[2].VirtualAddress = inst->lb;      ranges[2].NumberOfBytes = (size_t)inst->ncols * sizeof(double);
+	ranges[3].VirtualAddress = inst->ub;      ranges[3].NumberOfBytes = (size_t)inst->ncols * sizeof(double);
+	if (!PrefetchVirtualMemory(GetCurrentProcess(), 4, ranges, 0)) print_warning("[finalize_store]: Failed to prefetch the column data.\n");
+}
+
+void close_store(INSTANCE* inst) {
+
+	STORE* store = &(inst->store); /**< Store of the instance. */
+
+	if (store->view == NULL) return;
+
+	// The arrays in the store are not freed
+	inst->cmatbeg = NULL; inst->cmatind = NULL; inst->cmatval = NULL;
+	inst->obj = NULL; inst->lb = NULL; inst->ub = NULL; inst->vartype = NULL;
+
+	// Unmap and delete the backing file
+	if (!UnmapViewOfFile(store->view)) print_warning("[close_store]: Failed to unmap the store file %s.\n", store->path);
+	CloseHandle(store->mapping);
+	CloseHandle(store->file);
+	if (!DeleteFileA(store->path)) print_warning("[close_store]: Failed to delete the store file %s.\n", store->path);
+	store->view = NULL; store->mapping = NULL; store->file = NULL;
+	store->size = 0; store->used = 0;
+}
+
+size_t store_section(size_t size) {
+
+	// Sections aligned to the cache line
+	return (size + STORE_ALIGN - 1) / STORE_ALIGN * STORE_ALIGN;
+}
@@ -0,0 +1,61 @@
+/**
+ * @file multistart.c
+ * @author Ivan Viviani
+ * @copyright Copyright (c) 2020
+ */
+
+#include "ziround.h"
+
+void multi_start(INSTANCE* inst, int* numrounds) {
+
+	INSTANCE* starts;  /**< Clones of the instance, one per start (shared problem data). */
+	int* rounds;       /**< Number of rounds performed by each start. */
+	int num_starts;    /**< Number of starts. */
+	int best;          /**< Index of the best start. */
+	unsigned int base; /**< Base of the seeds of the starts. */
+
+	num_starts = inst->num_starts;
+	if (num_starts <= 0) print_error("[multi_start]: Number of starts %d not supported.\n", num_starts);
+	if (inst->components) print_warning("[multi_start]: Component rounding not supported by the multi-start, whole instance rounded.\n"); // [EXTENSION]
+
+	// Allocate / Initialize
+	starts = (INSTANCE*)calloc(num_starts, sizeof(INSTANCE));
+	rounds = (int*)calloc(num_starts, sizeof(int)); if (starts == NULL || rounds == NULL) print_error("[multi_start]: Failed to allocate starts.\n");
+	base = (inst->rseed >= 0) ? (unsigned int)inst->rseed : 0;
+	if (inst->one_opt) build_row_view(inst); // [EXTENSION] Shared by the clones (built once, before the parallel starts)
+
+	// Clone the instance state and draw the column permutations (the first start keeps the index order)
+	for (int s = 0; s < num_starts; s++) {
+		clone_inst(&(starts[s]), inst);
+		if (s == 0) continue;
+		starts[s].perm = (int*)malloc(inst->ncols * sizeof(int)); if (starts[s].perm == NULL) print_error("[multi_start]: Failed to allocate permutation of start %d.\n", s);
+		random_permutation(starts[s].perm, inst->ncols, base + (unsigned int)s);
+	}
+
+	// Run the starts in parallel (each one only writes its own clone)
+	#pragma omp parallel for schedule(dynamic, 1)
+	for (int s = 0; s < num_starts; s++) {
+		zi_round(&(starts[s]), &(rounds[s]));
+	}
+
+	// Select the best start: least fractional first, then best objective
+	best = 0;
+	inst->ms_feasible = 0;
+	for (int s = 0; s < num_starts; s++) {
+		print_verbose(20, "[multi_start]: Start %d: solfrac %f | objval %f | rounds %d\n", s, starts[s].solfrac, starts[s].objval, rounds[s]);
+		if (zero(starts[s].solfrac)) inst->ms_feasible++;
+		if (less_than(starts[s].solfrac, starts[best].solfrac)) { best = s; continue; }
+		if (!equals(starts[s].solfrac, starts[best].solfrac)) continue;
+		if ((inst->objsen == CPX_MIN) ? less_than(starts[s].objval, starts[best].objval) : greater_than(starts[s].objval, starts[best].objval)) best = s;
+	}
+	inst->ms_best = best;
+	print_verbose(10, "[multi_start]: Best start %d of %d (%d reached zero fractionality).\n", best, num_starts, inst->ms_feasible);
+
+	// Copy the best rounding back into the instance
+	copy_inst_state(inst, &(starts[best]));
+	*numrounds = rounds[best];
+
+	// Free
+	for (int s = 0; s < num_starts; s++) free_clone(&(starts[s]));
+	free_all(2, starts, rounds);
+}
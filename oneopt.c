@@ -0,0 +1,145 @@
+/**
+ * @file oneopt.c
+ * @author Ivan Viviani
+ * @copyright Copyright (c) 2020
+ */
+
+#include "ziround.h"
+
+void one_opt(INSTANCE* inst) {
+
+	double* delta_up;   /**< Maximum variable up-shifts. */
+	double* delta_down; /**< Maximum variable down-shifts. */
+	double* gain;       /**< Objective gain of the best shift of each variable. */
+	int* stamp;         /**< Current stamp of each variable (incremented whenever its gain is evaluated again). */
+	int* visited;       /**< Last shift after which each variable has been evaluated again. */
+	HEAP heap;          /**< Candidate variables in decreasing order of gain. */
+	int j;              /**< Index of the current variable. */
+	double key;         /**< Gain of the popped entry. */
+	int entry_stamp;    /**< Stamp of the popped entry. */
+	COL_ITER col;       /**< Iterator over the constraints containing variable x_j. */
+	double aij;         /**< Coefficient of xj in the current constraint (unused). */
+	nzind_t rowend;     /**< Index of the last variable of the current constraint. */
+	int rowind;         /**< Current row index. */
+	int varind;         /**< Current variable index. */
+	double new_gain;    /**< Gain of a variable evaluated again. */
+	int num_toround;    /**< Number of variables to round (unchanged by shifts of non-fractional variables). */
+	LARGE_INTEGER freq, start, end; /**< Variables for measuring execution time of the bulk evaluation. */
+
+	inst->oneopt_shifts = 0;
+	inst->oneopt_evals = 0;
+	num_toround = 0;
+
+	// Skip the phase if want to wait until zero fractionality
+	if (inst->after0frac && !zero(inst->solfrac)) return;
+
+	// [EXTENSION] The neighbours of a shifted variable are found through the row view (built now in CSC-only mode)
+	build_row_view(inst);
+
+	// Allocate / Initialize
+	delta_up   = (double*)calloc(inst->ncols, sizeof(double));
+	delta_down = (double*)calloc(inst->ncols, sizeof(double));
+	gain       = (double*)calloc(inst->ncols, sizeof(double));
+	stamp      = (int*)calloc(inst->ncols, sizeof(int));
+	visited    = (int*)malloc(inst->ncols * sizeof(int)); if (delta_up == NULL || delta_down == NULL || gain == NULL || stamp == NULL || visited == NULL) print_error("[one_opt]: Failed to allocate 1-opt structures.\n");
+	for (j = 0; j < inst->ncols; j++) visited[j] = -1;
+
+	// Clip row slacks slightly out of sign (as done by delta_updown), so that the parallel evaluations only read them
+	for (int i = 0; i < inst->nrows; i++) {
+		if ((inst->rows[i].sense == 'L') && (inst->rows[i].slack < 0.0) && (inst->rows[i].slack >= -(TOLERANCE))) inst->rows[i].slack = 0.0;
+		if ((inst->rows[i].sense == 'G') && (inst->rows[i].slack > 0.0) && (inst->rows[i].slack <= TOLERANCE)) inst->rows[i].slack = 0.0;
+	}
+
+	// Evaluate the gains of all the candidates in parallel (each thread writes only the j-th entries)
+	QueryPerformanceFrequency(&freq);
+	QueryPerformanceCounter(&start);
+	if (inst->sell_oneopt) sell_gains(inst, gain, delta_up, delta_down); // [EXTENSION] Sliced ELLPACK layout of the candidate columns
+	else {
+		#pragma omp parallel for schedule(dynamic, 256)
+		for (j = 0; j < inst->ncols; j++) {
+			gain[j] = (oneopt_candidate(inst, j)) ? oneopt_gain(inst, j, delta_up, delta_down) : 0.0;
+		}
+	}
+	QueryPerformanceCounter(&end);
+	print_verbose(10, "[one_opt]: Bulk evaluation of the candidates in %.3f ms (%s).\n",
+		(double)(end.QuadPart - start.QuadPart) * 1000.0 / (double)freq.QuadPart, (inst->sell_oneopt) ? "SELL-C-sigma" : "CSC");
+
+	// Push the improving candidates into the heap
+	heap_init(&heap, inst->ncols);
+	for (j = 0; j < inst->ncols; j++) {
+		if (!oneopt_candidate(inst, j)) continue;
+		inst->oneopt_evals++;
+		if (positive(gain[j])) heap_push(&heap, j, gain[j], stamp[j]);
+	}
+	print_verbose(20, "[one_opt]: %d candidates, %d improving.\n", inst->oneopt_evals, heap.size);
+
+	// Apply the shifts greedily, in decreasing order of gain
+	while (heap.size > 0) {
+
+		heap_pop(&heap, &j, &key, &entry_stamp);
+
+		// Skip stale entries (xj has been evaluated again after the push)
+		if (entry_stamp != stamp[j]) continue;
+
+		// Compute the deltas of xj again (they were overwritten by other evaluations) and shift it
+		if (!positive(oneopt_gain(inst, j, delta_up, delta_down))) continue;
+		if (!round_xj_bestobj(inst, j, inst->obj[j], delta_up[j], delta_down[j], 0, &(inst->solfrac), &num_toround)) continue;
+		inst->oneopt_shifts++;
+		print_verbose(20, "[one_opt]: >>> Shifted x_%d (gain %f)\n", j + 1, key);
+
+		// Evaluate again the candidates that share a constraint with xj (only their slacks changed)
+		for (col_begin(inst, j, &col); col_next(&col, &rowind, &aij); ) {
+
+			assert(index_in_bounds(rowind, inst->nrows));
+			rowend = inst->rmatbeg[rowind + 1];
+
+			for (nzind_t h = inst->rmatbeg[rowind]; h < rowend; h++) {
+
+				varind = inst->rmatind[h];
+				assert(index_in_bounds(varind, inst->ncols));
+
+				// Evaluate each variable at most once per shift
+				if (visited[varind] == inst->oneopt_shifts) continue;
+				visited[varind] = inst->oneopt_shifts;
+				if (!oneopt_candidate(inst, varind)) continue;
+
+				stamp[varind]++;
+				new_gain = oneopt_gain(inst, varind, delta_up, delta_down);
+				inst->oneopt_evals++;
+				if (positive(new_gain)) heap_push(&heap, varind, new_gain, stamp[varind]);
+			}
+		}
+	}
+
+	print_verbose(20, "[one_opt]: %d shifts, %d evaluations.\n", inst->oneopt_shifts, inst->oneopt_evals);
+
+	// Free
+	heap_free(&heap);
+	free_all(5, delta_up, delta_down, gain, stamp, visited);
+}
+
+double oneopt_gain(INSTANCE* inst, int j, double* delta_up, double* delta_down) {
+
+	// Calculate integral deltas (with epsilon = 1.0)
+	integral_deltas(inst, j, delta_up, delta_down);
+
+	return oneopt_shift_gain(inst, j, delta_up[j], delta_down[j]);
+}
+
+double oneopt_shift_gain(INSTANCE* inst, int j, double delta_up, double delta_down) {
+
+	double sign;      /**< Sign of the objective improvement of an up-shift per unit of objective coefficient. */
+	double gain_up;   /**< Objective improvement of the up-shift. */
+	double gain_down; /**< Objective improvement of the down-shift. */
+
+	sign = (inst->objsen == CPX_MIN) ? -1.0 : 1.0;
+	gain_up = sign * inst->obj[j] * delta_up;
+	gain_down = -sign * inst->obj[j] * delta_down;
+
+	return max(0.0, max(gain_up, gain_down));
+}
+
+int oneopt_candidate(INSTANCE* inst, int j) {
+
+	return (inst->int_var[j] && !equals(inst->lb[j], inst->ub[j]) && !zero(inst->obj[j]) && !is_fractional(inst->x[j]));
+}
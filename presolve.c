@@ -0,0 +1,434 @@
+/**
+ * @file presolve.c
+ * @author Ivan Viviani
+ * @copyright Copyright (c) 2020
+ */
+
+#include "ziround.h"
+
+void presolve(INSTANCE* inst) {
+
+	PRE_PROBLEM pp;     /**< Working copy of the problem. */
+	nzind_t nzcnt;      /**< Number of nonzeros of the problem. */
+	nzind_t unused = 0; /**< Support variable. */
+	nzind_t pos;        /**< Support variable. */
+	int* ind;           /**< Indices of the bounds and right hand sides to change. */
+	char* lu;           /**< Types of the bounds to change. */
+	double* val;        /**< New bounds and right hand sides. */
+	int cnt;            /**< Number of bounds or right hand sides to change. */
+	int changes;        /**< Number of changes of the current pass. */
+	int duplicates;     /**< Number of duplicate rows removed. */
+	int removed_cols;   /**< Number of columns removed. */
+	int removed_rows;   /**< Number of rows removed. */
+	int status = 0;
+
+	if (!(inst->presolve)) return;
+
+	pp.ncols = CPXgetnumcols(inst->env, inst->lp);
+	pp.nrows = CPXgetnumrows(inst->env, inst->lp);
+	nzcnt = ZI_getnumnz(inst->env, inst->lp);
+	assert(positive_integer(pp.ncols));
+	if ((pp.nrows == 0) || (nzcnt == 0)) {
+		print_warning("[presolve]: Problem without constraints, presolve skipped.\n");
+		return;
+	}
+
+	// Allocate
+	pp.cbeg = (nzind_t*)malloc(((size_t)pp.ncols + 1) * sizeof(nzind_t));
+	pp.cind = (int*)malloc((size_t)nzcnt * sizeof(int));
+	pp.cval = (double*)malloc((size_t)nzcnt * sizeof(double));
+	pp.rbeg = (nzind_t*)calloc((size_t)pp.nrows + 1, sizeof(nzind_t));
+	pp.rind = (int*)malloc((size_t)nzcnt * sizeof(int));
+	pp.rval = (double*)malloc((size_t)nzcnt * sizeof(double));
+	pp.lb = (double*)malloc((size_t)pp.ncols * sizeof(double));
+	pp.ub = (double*)malloc((size_t)pp.ncols * sizeof(double));
+	pp.obj = (double*)malloc((size_t)pp.ncols * sizeof(double));
+	pp.ctype = (char*)malloc((size_t)pp.ncols * sizeof(char));
+	pp.rhs = (double*)malloc((size_t)pp.nrows * sizeof(double));
+	pp.sense = (char*)malloc((size_t)pp.nrows * sizeof(char));
+	pp.coldel = (int*)calloc((size_t)pp.ncols, sizeof(int));
+	pp.rowdel = (int*)calloc((size_t)pp.nrows, sizeof(int));
+	pp.rowlen = (int*)calloc((size_t)pp.nrows, sizeof(int));
+	if (pp.cbeg == NULL || pp.cind == NULL || pp.cval == NULL || pp.rbeg == NULL || pp.rind == NULL || pp.rval == NULL ||
+		pp.lb == NULL || pp.ub == NULL || pp.obj == NULL || pp.ctype == NULL || pp.rhs == NULL || pp.sense == NULL ||
+		pp.coldel == NULL || pp.rowdel == NULL || pp.rowlen == NULL) {
+		print_error("[presolve]: Failed to allocate the working copy of the problem.\n");
+	}
+	pp.tightened = 0;
+
+	// Problem data
+	if (ZI_getcols(inst->env, inst->lp, &unused, pp.cbeg, pp.cind, pp.cval, nzcnt, &unused, 0, pp.ncols - 1)) print_error("[presolve]: Failed to obtain columns info.\n");
+	pp.cbeg[pp.ncols] = nzcnt;
+	if (CPXgetlb(inst->env, inst->lp, pp.lb, 0, pp.ncols - 1)) print_error("[presolve]: Failed to obtain lower bounds.\n");
+	if (CPXgetub(inst->env, inst->lp, pp.ub, 0, pp.ncols - 1)) print_error("[presolve]: Failed to obtain upper bounds.\n");
+	if (CPXgetobj(inst->env, inst->lp, pp.obj, 0, pp.ncols - 1)) print_error("[presolve]: Failed to obtain objective coefficients.\n");
+	if (CPXgetctype(inst->env, inst->lp, pp.ctype, 0, pp.ncols - 1)) print_error("[presolve]: Failed to obtain MIP variable types.\n");
+	if (CPXgetrhs(inst->env, inst->lp, pp.rhs, 0, pp.nrows - 1)) print_error("[presolve]: Failed to obtain rhs.\n");
+	if (CPXgetsense(inst->env, inst->lp, pp.sense, 0, pp.nrows - 1)) print_error("[presolve]: Failed to obtain constraints senses.\n");
+
+	// Ranged rows and semi-continuous columns are not handled: problem left as it is
+	for (int i = 0; i < pp.nrows; i++) {
+		if (pp.sense[i] != 'R') continue;
+		print_warning("[presolve]: Ranged constraints not supported, presolve skipped.\n");
+		free_pre_problem(&pp);
+		return;
+	}
+	for (int j = 0; j < pp.ncols; j++) {
+		if ((pp.ctype[j] != CPX_SEMICONT) && (pp.ctype[j] != CPX_SEMIINT)) continue;
+		print_warning("[presolve]: Semi-continuous variables not supported, presolve skipped.\n");
+		free_pre_problem(&pp);
+		return;
+	}
+
+	// Matrix by rows (transpose of the matrix by columns, increasing column indices within each row)
+	for (nzind_t k = 0; k < nzcnt; k++) pp.rbeg[pp.cind[k] + 1]++;
+	for (int i = 0; i < pp.nrows; i++) {
+		pp.rowlen[i] = (int)pp.rbeg[i + 1];
+		pp.rbeg[i + 1] += pp.rbeg[i];
+	}
+	for (int j = 0; j < pp.ncols; j++) {
+		for (nzind_t k = pp.cbeg[j]; k < pp.cbeg[j + 1]; k++) {
+			pos = pp.rbeg[pp.cind[k]]++;
+			pp.rind[pos] = j;
+			pp.rval[pos] = pp.cval[k];
+		}
+	}
+	for (int i = pp.nrows; i > 0; i--) pp.rbeg[i] = pp.rbeg[i - 1];
+	pp.rbeg[0] = 0;
+
+	// Values of the removed columns
+	inst->pre.fixval = (double*)calloc((size_t)pp.ncols, sizeof(double)); if (inst->pre.fixval == NULL) print_error("[presolve]: Failed to allocate fixval.\n");
+
+	// Integral bounds of the integer columns
+	for (int j = 0; j < pp.ncols; j++) {
+		if ((pp.ctype[j] != CPX_BINARY) && (pp.ctype[j] != CPX_INTEGER)) continue;
+		presolve_bound(&pp, j, 'L', pp.lb[j], 0.0);
+		presolve_bound(&pp, j, 'U', pp.ub[j], 0.0);
+	}
+
+	// Fixed columns and rows, until nothing changes
+	for (int pass = 0; pass < PRESOLVE_PASSES; pass++) {
+		changes = presolve_fixed_columns(inst, &pp);
+		changes += presolve_rows(&pp);
+		print_verbose(20, "[presolve]: Pass %d: %d changes.\n", pass + 1, changes);
+		if (changes == 0) break;
+	}
+	duplicates = presolve_duplicate_rows(&pp);
+
+	removed_cols = 0;
+	removed_rows = 0;
+	for (int j = 0; j < pp.ncols; j++) removed_cols += pp.coldel[j];
+	for (int i = 0; i < pp.nrows; i++) removed_rows += pp.rowdel[i];
+
+	// No constraint left: the reduction would not leave anything to round against
+	if (removed_rows == pp.nrows) {
+		print_warning("[presolve]: All the constraints are redundant, problem not reduced.\n");
+		free(inst->pre.fixval); inst->pre.fixval = NULL;
+		free_pre_problem(&pp);
+		return;
+	}
+
+	// Keep the original problem for the postsolve
+	inst->pre.orig_lp = CPXcloneprob(inst->env, inst->lp, &status); if (inst->pre.orig_lp == NULL) print_error("[presolve]: Failed to copy the original problem, error code %d.\n", status);
+	inst->pre.ncols = pp.ncols;
+	inst->pre.nrows = pp.nrows;
+
+	// Bounds of the columns kept and right hand sides of the rows kept
+	ind = (int*)malloc(2 * (size_t)max(pp.ncols, pp.nrows) * sizeof(int));
+	lu = (char*)malloc(2 * (size_t)pp.ncols * sizeof(char));
+	val = (double*)malloc(2 * (size_t)max(pp.ncols, pp.nrows) * sizeof(double));
+	if (ind == NULL || lu == NULL || val == NULL) print_error("[presolve]: Failed to allocate changes.\n");
+	cnt = 0;
+	for (int j = 0; j < pp.ncols; j++) {
+		if (pp.coldel[j]) continue;
+		ind[cnt] = j; lu[cnt] = 'L'; val[cnt++] = pp.lb[j];
+		ind[cnt] = j; lu[cnt] = 'U'; val[cnt++] = pp.ub[j];
+	}
+	if ((cnt > 0) && CPXchgbds(inst->env, inst->lp, cnt, ind, lu, val)) print_error("[presolve]: Failed to change the bounds.\n");
+	cnt = 0;
+	for (int i = 0; i < pp.nrows; i++) {
+		if (pp.rowdel[i]) continue;
+		ind[cnt] = i; val[cnt++] = pp.rhs[i];
+	}
+	if ((cnt > 0) && CPXchgrhs(inst->env, inst->lp, cnt, ind, val)) print_error("[presolve]: Failed to change the rhs.\n");
+
+	// Objective contribution of the removed columns
+	inst->pre.obj_offset = 0.0;
+	for (int j = 0; j < pp.ncols; j++) {
+		if (pp.coldel[j]) inst->pre.obj_offset += pp.obj[j] * inst->pre.fixval[j];
+	}
+
+	// Remove rows and columns (coldel becomes the new index of each column, -1 if removed)
+	if (CPXdelsetrows(inst->env, inst->lp, pp.rowdel)) print_error("[presolve]: Failed to remove the rows.\n");
+	if (CPXdelsetcols(inst->env, inst->lp, pp.coldel)) print_error("[presolve]: Failed to remove the columns.\n");
+	inst->pre.colmap = pp.coldel;
+	pp.coldel = NULL;
+
+	print_verbose(10, "[presolve]: Removed %d of %d columns and %d of %d rows (%d duplicate), %d bounds tightened, objective offset %f.\n",
+		removed_cols, pp.ncols, removed_rows, pp.nrows, duplicates, pp.tightened, inst->pre.obj_offset);
+
+	// Free
+	free_all(3, ind, lu, val);
+	free_pre_problem(&pp);
+}
+
+void postsolve(INSTANCE* inst) {
+
+	PRESOLVE* pre = &(inst->pre); /**< Map of the presolved problem. */
+	double* lb;                   /**< Original lower bounds. */
+	double* ub;                   /**< Original upper bounds. */
+	double* obj;                  /**< Original objective coefficients. */
+	nzind_t* rbeg;                /**< Original matrix by rows (begin indices, with the sentinel rbeg[nrows] = nzcnt). */
+	int* rind;                    /**< Original matrix by rows (column indices). */
+	double* rval;                 /**< Original matrix by rows (coefficients). */
+	char* sense;                  /**< Original constraint senses. */
+	double* rhs;                  /**< Original right hand sides. */
+	nzind_t nzcnt;                /**< Number of nonzeros of the original problem. */
+	nzind_t unused = 0;           /**< Support variable. */
+
+	if (!(inst->presolve) || (pre->orig_lp == NULL)) return;
+
+	// Lift the solution: the columns kept from the rounded solution, the removed ones at their fixed value
+	pre->x = (double*)malloc((size_t)pre->ncols * sizeof(double)); if (pre->x == NULL) print_error("[postsolve]: Failed to allocate the lifted solution.\n");
+	for (int j = 0; j < pre->ncols; j++) pre->x[j] = (pre->colmap[j] >= 0) ? inst->x[pre->colmap[j]] : pre->fixval[j];
+
+	// Original problem
+	nzcnt = ZI_getnumnz(inst->env, pre->orig_lp);
+	lb = (double*)malloc((size_t)pre->ncols * sizeof(double));
+	ub = (double*)malloc((size_t)pre->ncols * sizeof(double));
+	obj = (double*)malloc((size_t)pre->ncols * sizeof(double));
+	rbeg = (nzind_t*)malloc(((size_t)pre->nrows + 1) * sizeof(nzind_t));
+	rind = (int*)malloc((size_t)max(nzcnt, 1) * sizeof(int));
+	rval = (double*)malloc((size_t)max(nzcnt, 1) * sizeof(double));
+	sense = (char*)malloc((size_t)pre->nrows * sizeof(char));
+	rhs = (double*)malloc((size_t)pre->nrows * sizeof(double));
+	if (lb == NULL || ub == NULL || obj == NULL || rbeg == NULL || rind == NULL || rval == NULL || sense == NULL || rhs == NULL) {
+		print_error("[postsolve]: Failed to allocate the original problem.\n");
+	}
+	if (CPXgetlb(inst->env, pre->orig_lp, lb, 0, pre->ncols - 1)) print_error("[postsolve]: Failed to obtain lower bounds.\n");
+	if (CPXgetub(inst->env, pre->orig_lp, ub, 0, pre->ncols - 1)) print_error("[postsolve]: Failed to obtain upper bounds.\n");
+	if (CPXgetobj(inst->env, pre->orig_lp, obj, 0, pre->ncols - 1)) print_error("[postsolve]: Failed to obtain objective coefficients.\n");
+	if (ZI_getrows(inst->env, pre->orig_lp, &unused, rbeg, rind, rval, nzcnt, &unused, 0, pre->nrows - 1)) print_error("[postsolve]: Failed to obtain rows info.\n");
+	rbeg[pre->nrows] = nzcnt;
+	if (CPXgetsense(inst->env, pre->orig_lp, sense, 0, pre->nrows - 1)) print_error("[postsolve]: Failed to obtain constraints senses.\n");
+	if (CPXgetrhs(inst->env, pre->orig_lp, rhs, 0, pre->nrows - 1)) print_error("[postsolve]: Failed to obtain rhs.\n");
+
+	// Check the lifted solution on the original problem
+	check_bounds(pre->x, lb, ub, pre->ncols);
+	check_constraints(pre->x, pre->ncols, pre->nrows, rbeg, rind, rval, sense, rhs, NULL);
+
+	// Objective value of the original problem
+	inst->objval += pre->obj_offset;
+	assert(fabs(inst->objval - dot_product(obj, pre->x, pre->ncols)) <= TOLERANCE * max(1.0, fabs(inst->objval)));
+	print_verbose(10, "[postsolve]: Rounded solution lifted to the %d original columns, objective value %f.\n", pre->ncols, inst->objval);
+
+	// Free
+	free_all(8, lb, ub, obj, rbeg, rind, rval, sense, rhs);
+}
+
+int presolve_fixed_columns(INSTANCE* inst, PRE_PROBLEM* pp) {
+
+	int removed = 0; /**< Number of columns removed. */
+
+	for (int j = 0; j < pp->ncols; j++) {
+
+		if (pp->coldel[j] || (fabs(pp->lb[j]) >= CPX_INFBOUND) || !equals(pp->lb[j], pp->ub[j])) continue;
+
+		// Move the column to the right hand sides (integer columns have integral bounds)
+		inst->pre.fixval[j] = pp->lb[j];
+		pp->coldel[j] = 1;
+		for (nzind_t k = pp->cbeg[j]; k < pp->cbeg[j + 1]; k++) {
+			if (pp->rowdel[pp->cind[k]]) continue;
+			pp->rhs[pp->cind[k]] -= pp->cval[k] * pp->lb[j];
+			pp->rowlen[pp->cind[k]]--;
+		}
+		removed++;
+	}
+
+	return removed;
+}
+
+int presolve_rows(PRE_PROBLEM* pp) {
+
+	int changes = 0;  /**< Number of rows removed plus number of bounds tightened. */
+	int j;            /**< Current column index. */
+	double a;         /**< Current coefficient. */
+	double minact;    /**< Minimum activity of the row over the finite bounds. */
+	double maxact;    /**< Maximum activity of the row over the finite bounds. */
+	int ninf_min;     /**< Number of infinite contributions to the minimum activity. */
+	int ninf_max;     /**< Number of infinite contributions to the maximum activity. */
+	double lo;        /**< Bound of the current column giving the minimum contribution. */
+	double hi;        /**< Bound of the current column giving the maximum contribution. */
+
+	for (int i = 0; i < pp->nrows; i++) {
+
+		if (pp->rowdel[i]) continue;
+
+		// Empty row: check the right hand side
+		if (pp->rowlen[i] == 0) {
+			if (((pp->sense[i] == 'L') && negative(pp->rhs[i])) || ((pp->sense[i] == 'G') && positive(pp->rhs[i])) || ((pp->sense[i] == 'E') && !zero(pp->rhs[i]))) {
+				print_error("[presolve_rows][row %d '%c']: Infeasible empty row, rhs = %f.\n", i + 1, pp->sense[i], pp->rhs[i]);
+			}
+			pp->rowdel[i] = 1;
+			changes++;
+			continue;
+		}
+
+		// Singleton row: bound of its column
+		if (pp->rowlen[i] == 1) {
+			j = -1; a = 0.0;
+			for (nzind_t k = pp->rbeg[i]; k < pp->rbeg[i + 1]; k++) {
+				if (pp->coldel[pp->rind[k]]) continue;
+				j = pp->rind[k]; a = pp->rval[k];
+				break;
+			}
+			assert(j >= 0);
+			if (pp->sense[i] != 'G') presolve_bound(pp, j, (a > 0.0) ? 'U' : 'L', pp->rhs[i] / a, 0.0);
+			if (pp->sense[i] != 'L') presolve_bound(pp, j, (a > 0.0) ? 'L' : 'U', pp->rhs[i] / a, 0.0);
+			pp->rowdel[i] = 1;
+			changes++;
+			continue;
+		}
+
+		// Activity bounds of the row
+		minact = 0.0; maxact = 0.0;
+		ninf_min = 0; ninf_max = 0;
+		for (nzind_t k = pp->rbeg[i]; k < pp->rbeg[i + 1]; k++) {
+			j = pp->rind[k];
+			if (pp->coldel[j]) continue;
+			lo = (pp->rval[k] > 0.0) ? pp->lb[j] : pp->ub[j];
+			hi = (pp->rval[k] > 0.0) ? pp->ub[j] : pp->lb[j];
+			if (fabs(lo) >= CPX_INFBOUND) ninf_min++; else minact += pp->rval[k] * lo;
+			if (fabs(hi) >= CPX_INFBOUND) ninf_max++; else maxact += pp->rval[k] * hi;
+		}
+
+		// Infeasible row
+		if (((pp->sense[i] != 'G') && (ninf_min == 0) && (minact > pp->rhs[i] + TOLERANCE * max(1.0, fabs(pp->rhs[i])))) ||
+			((pp->sense[i] != 'L') && (ninf_max == 0) && (maxact < pp->rhs[i] - TOLERANCE * max(1.0, fabs(pp->rhs[i]))))) {
+			print_error("[presolve_rows][row %d '%c']: Infeasible row, activity in [%f, %f], rhs = %f.\n", i + 1, pp->sense[i], minact, maxact, pp->rhs[i]);
+		}
+
+		// Redundant row: satisfied by any point within the bounds
+		if (((pp->sense[i] == 'L') && (ninf_max == 0) && (maxact <= pp->rhs[i])) ||
+			((pp->sense[i] == 'G') && (ninf_min == 0) && (minact >= pp->rhs[i]))) {
+			pp->rowdel[i] = 1;
+			changes++;
+			continue;
+		}
+
+		// Bounds implied by the row on each column (activity bounds of the other columns, all finite)
+		for (nzind_t k = pp->rbeg[i]; k < pp->rbeg[i + 1]; k++) {
+			j = pp->rind[k];
+			a = pp->rval[k];
+			if (pp->coldel[j] || (fabs(a) < TOLERANCE)) continue;
+			lo = (a > 0.0) ? pp->lb[j] : pp->ub[j];
+			hi = (a > 0.0) ? pp->ub[j] : pp->lb[j];
+			if ((pp->sense[i] != 'G') && (ninf_min == 0)) changes += presolve_bound(pp, j, (a > 0.0) ? 'U' : 'L', lo + (pp->rhs[i] - minact) / a, PRESOLVE_MIN_GAIN);
+			if ((pp->sense[i] != 'L') && (ninf_max == 0)) changes += presolve_bound(pp, j, (a > 0.0) ? 'L' : 'U', hi + (pp->rhs[i] - maxact) / a, PRESOLVE_MIN_GAIN);
+		}
+	}
+
+	return changes;
+}
+
+int presolve_duplicate_rows(PRE_PROBLEM* pp) {
+
+	long long* key;          /**< Sort keys of the rows (hash of the coefficients, then index). */
+	unsigned int hash;       /**< Hash of the coefficients of the current row. */
+	unsigned long long bits; /**< Bits of the current coefficient. */
+	int num_keys;            /**< Number of rows hashed. */
+	int removed = 0;         /**< Number of rows removed. */
+	int r1, r2;              /**< Rows compared. */
+
+	key = (long long*)malloc((size_t)max(pp->nrows, 1) * sizeof(long long)); if (key == NULL) print_error("[presolve_duplicate_rows]: Failed to allocate sort keys.\n");
+
+	// Hash of the columns and coefficients of each row (FNV-1a)
+	num_keys = 0;
+	for (int i = 0; i < pp->nrows; i++) {
+		if (pp->rowdel[i]) continue;
+		hash = 2166136261u;
+		for (nzind_t k = pp->rbeg[i]; k < pp->rbeg[i + 1]; k++) {
+			if (pp->coldel[pp->rind[k]]) continue;
+			memcpy(&bits, &(pp->rval[k]), sizeof(double));
+			hash = (hash ^ (unsigned int)pp->rind[k]) * 16777619u;
+			hash = (hash ^ (unsigned int)(bits ^ (bits >> 32))) * 16777619u;
+		}
+		key[num_keys++] = ((long long)(hash & 0x7FFFFFFF) << 32) | i;
+	}
+	qsort(key, (size_t)num_keys, sizeof(long long), compare_row_keys);
+
+	// Compare the rows with the same hash, keeping the first one with the tighter right hand side
+	for (int a = 0; a < num_keys; a++) {
+		r1 = (int)(key[a] & 0xFFFFFFFF);
+		if (pp->rowdel[r1]) continue;
+		for (int b = a + 1; (b < num_keys) && ((key[b] >> 32) == (key[a] >> 32)); b++) {
+			r2 = (int)(key[b] & 0xFFFFFFFF);
+			if (pp->rowdel[r2] || (pp->sense[r2] != pp->sense[r1]) || !same_row(pp, r1, r2)) continue;
+			switch (pp->sense[r1]) {
+				case 'L': pp->rhs[r1] = min(pp->rhs[r1], pp->rhs[r2]); break;
+				case 'G': pp->rhs[r1] = max(pp->rhs[r1], pp->rhs[r2]); break;
+				case 'E':
+					if (!equals(pp->rhs[r1], pp->rhs[r2])) print_error("[presolve_duplicate_rows]: Infeasible equality rows %d and %d (same coefficients, rhs %f and %f).\n", r1 + 1, r2 + 1, pp->rhs[r1], pp->rhs[r2]);
+					break;
+				default:
+					print_error("[presolve_duplicate_rows]: Constraint sense '%c' not included in {'L','G','E'}.\n", pp->sense[r1]);
+			}
+			pp->rowdel[r2] = 1;
+			removed++;
+		}
+	}
+
+	// Free
+	free(key);
+
+	return removed;
+}
+
+int presolve_bound(PRE_PROBLEM* pp, int j, char lu, double value, double min_gain) {
+
+	int is_int = (pp->ctype[j] == CPX_BINARY) || (pp->ctype[j] == CPX_INTEGER); /**< Flag of an integer column. */
+	double gain;                                                                  /**< Tightening of the bound. */
+
+	if (fabs(value) >= CPX_INFBOUND) return 0;
+
+	// Integer columns: integral bounds
+	if (is_int) value = (lu == 'U') ? floor(value + TOLERANCE) : ceil(value - TOLERANCE);
+
+	gain = (lu == 'U') ? pp->ub[j] - value : value - pp->lb[j];
+	if (gain <= max(TOLERANCE, (is_int) ? 0.0 : min_gain * max(1.0, fabs(value)))) return 0;
+	if (lu == 'U') pp->ub[j] = value;
+	else pp->lb[j] = value;
+	pp->tightened++;
+
+	// Crossing bounds: infeasible, or equal up to the tolerance
+	if (pp->lb[j] > pp->ub[j]) {
+		if (pp->lb[j] > pp->ub[j] + TOLERANCE) print_error("[presolve_bound]: Infeasible bounds of column %d: [%f, %f].\n", j + 1, pp->lb[j], pp->ub[j]);
+		if (lu == 'U') pp->ub[j] = pp->lb[j];
+		else pp->lb[j] = pp->ub[j];
+	}
+
+	return 1;
+}
+
+int same_row(PRE_PROBLEM* pp, int r1, int r2) {
+
+	nzind_t k1 = pp->rbeg[r1]; /**< Position in the first row. */
+	nzind_t k2 = pp->rbeg[r2]; /**< Position in the second row. */
+
+	if (pp->rowlen[r1] != pp->rowlen[r2]) return 0;
+
+	// Merge the two rows, skipping the removed columns
+	while (1) {
+		while ((k1 < pp->rbeg[r1 + 1]) && pp->coldel[pp->rind[k1]]) k1++;
+		while ((k2 < pp->rbeg[r2 + 1]) && pp->coldel[pp->rind[k2]]) k2++;
+		if ((k1 == pp->rbeg[r1 + 1]) || (k2 == pp->rbeg[r2 + 1])) return (k1 == pp->rbeg[r1 + 1]) && (k2 == pp->rbeg[r2 + 1]);
+		if ((pp->rind[k1] != pp->rind[k2]) || (pp->rval[k1] != pp->rval[k2])) return 0;
+		k1++; k2++;
+	}
+}
+
+void free_pre_problem(PRE_PROBLEM* pp) {
+
+	free_all(15, pp->cbeg, pp->cind, pp->cval, pp->rbeg, pp->rind, pp->rval, pp->lb, pp->ub, pp->obj, pp->ctype,
+		pp->rhs, pp->sense, pp->coldel, pp->rowdel, pp->rowlen);
+}
@@ -16,6 +16,9 @@ void populate_inst(INSTANCE* inst) {
 		positive_integer(inst->ncols)
 	);
 
+	// [EXTENSION] Out-of-core mode: the column data is read directly into a memory-mapped file
+	open_store(inst);
+
 	// Read solution info
 	read_solution(inst);
 	read_variable_bounds(inst);
@@ -32,13 +35,30 @@ void populate_inst(INSTANCE* inst) {
 	read_constraints_senses(inst);
 	read_constraints_right_hand_sides(inst);
 	read_row_slacks(inst);
-	check_constraints(inst->x, inst->ncols, inst->nrows, inst->nzcnt, inst->rmatbeg, inst->rmatind, inst->rmatval, inst->sense, inst->rhs);
+
+	// [EXTENSION] Matrix preprocessing (if enabled): row renumbering, compressed columns, single precision coefficients
+	reorder_rows(inst);
+	compress_columns(inst);
+	narrow_coefficients(inst);
+	check_inst_constraints(inst);
 
 	// Extension (if enabled)
 	if (inst->singletons) {
 		find_singletons(inst);
 		compute_singletons_slacks(inst);
 	}
+
+	// [EXTENSION] Candidate columns of ZI-Round
+	find_movable_columns(inst);
+
+	// [EXTENSION] Rows with exact integer slacks (if enabled)
+	if (inst->int_rows) find_integral_rows(inst);
+
+	// [EXTENSION] Sliced ELLPACK copy of the 1-opt candidates (if enabled)
+	load_sell(inst);
+
+	// [EXTENSION] Out-of-core mode: complete the store
+	finalize_store(inst);
 }
 
 void read_solution(INSTANCE* inst) {
@@ -77,8 +97,8 @@ void read_solution(INSTANCE* inst) {
 void read_variable_bounds(INSTANCE* inst) {
 
 	// Allocate variable bounds
-	inst->ub = (double*)malloc(inst->ncols * sizeof(double)); if (inst->ub == NULL) print_error("[read_variable_bounds]: Failed to allocate variables upper bounds.\n");
-	inst->lb = (double*)malloc(inst->ncols * sizeof(double)); if (inst->lb == NULL) print_error("[read_variable_bounds]: Failed to allocate variables lower bounds.\n");
+	inst->ub = (double*)store_alloc(inst, inst->ncols * sizeof(double)); if (inst->ub == NULL) print_error("[read_variable_bounds]: Failed to allocate variables upper bounds.\n");
+	inst->lb = (double*)store_alloc(inst, inst->ncols * sizeof(double)); if (inst->lb == NULL) print_error("[read_variable_bounds]: Failed to allocate variables lower bounds.\n");
 
 	// Get variable bounds (upper and lower)
 	if (CPXgetub(inst->env, inst->lp, inst->ub, 0, inst->ncols - 1)) print_error("[read_variable_bounds]: Failed to obtain upper bounds.\n");
@@ -97,7 +117,7 @@ void read_objective_value(INSTANCE* inst) {
 void read_objective_coefficients(INSTANCE* inst) {
 
 	// Allocate objective coefficients
-	inst->obj = (double*)malloc(inst->ncols * sizeof(double)); if (inst->obj == NULL) print_error("[read_objective_coefficients]: Failed to allocate objective coefficients.\n");
+	inst->obj = (double*)store_alloc(inst, inst->ncols * sizeof(double)); if (inst->obj == NULL) print_error("[read_objective_coefficients]: Failed to allocate objective coefficients.\n");
 
 	// Get objective coefficients
 	if (CPXgetobj(inst->env, inst->lp, inst->obj, 0, inst->ncols - 1)) print_error("[read_objective_coefficients]: Failed to obtain objective coefficients.\n");
@@ -114,26 +134,101 @@ void read_objective_coefficients(INSTANCE* inst) {
 
 void read_constraints_coefficients(INSTANCE* inst) {
 
-	int unused = 0;
+	nzind_t unused = 0;
 
 	// First, get the number of non zero coefficients of the matrix (nzcnt)
-	inst->nzcnt = CPXgetnumnz(inst->env, inst->lp);
-	assert(positive_integer(inst->nzcnt));
-
-	// Allocate constraints info
-	inst->rmatbeg = (int*)malloc(inst->nrows * sizeof(int));
-	inst->rmatind = (int*)malloc(inst->nzcnt * sizeof(int));
-	inst->rmatval = (double*)malloc(inst->nzcnt * sizeof(double));
-	inst->cmatbeg = (int*)malloc(inst->ncols * sizeof(int));
-	inst->cmatind = (int*)malloc(inst->nzcnt * sizeof(int));
-	inst->cmatval = (double*)malloc(inst->nzcnt * sizeof(double));
-	if (inst->rmatbeg == NULL || inst->rmatind == NULL || inst->rmatval == NULL || inst->cmatbeg == NULL || inst->cmatind == NULL || inst->cmatval == NULL) {
-		print_error("[read_constraints_coefficients]: Failed to allocate one of rmatbeg, rmatind, rmatval, cmatbeg, cmatind, cmatval.\n");
+	inst->nzcnt = ZI_getnumnz(inst->env, inst->lp);
+	assert(inst->nzcnt > 0);
+
+	// Allocate constraints info (by columns, with the sentinel cmatbeg[ncols] = nzcnt)
+	inst->cmatbeg = (nzind_t*)store_alloc(inst, ((size_t)inst->ncols + 1) * sizeof(nzind_t));
+	inst->cmatind = (int*)store_alloc(inst, (size_t)inst->nzcnt * sizeof(int));
+	inst->cmatval = (double*)store_alloc(inst, (size_t)inst->nzcnt * sizeof(double));
+	if (inst->cmatbeg == NULL || inst->cmatind == NULL || inst->cmatval == NULL) {
+		print_error("[read_constraints_coefficients]: Failed to allocate one of cmatbeg, cmatind, cmatval.\n");
+	}
+
+	// [EXTENSION] CSC-only mode: the row view is built on demand (see build_row_view)
+	if (!(inst->csc_only)) {
+
+		// Allocate constraints info (by rows, with the sentinel rmatbeg[nrows] = nzcnt)
+		inst->rmatbeg = (nzind_t*)malloc(((size_t)inst->nrows + 1) * sizeof(nzind_t));
+		inst->rmatind = (int*)malloc((size_t)inst->nzcnt * sizeof(int));
+		inst->rmatval = (double*)malloc((size_t)inst->nzcnt * sizeof(double));
+		if (inst->rmatbeg == NULL || inst->rmatind == NULL || inst->rmatval == NULL) {
+			print_error("[read_constraints_coefficients]: Failed to allocate one of rmatbeg, rmatind, rmatval.\n");
+		}
+		if (ZI_getrows(inst->env, inst->lp, &unused, inst->rmatbeg, inst->rmatind, inst->rmatval, inst->nzcnt, &unused, 0, inst->nrows - 1)) print_error("[read_constraints_coefficients]: Failed to obtain rows info.\n");
+		inst->rmatbeg[inst->nrows] = inst->nzcnt;
+	}
+
+	// Get constraint matrix by columns
+	if (ZI_getcols(inst->env, inst->lp, &unused, inst->cmatbeg, inst->cmatind, inst->cmatval, inst->nzcnt, &unused, 0, inst->ncols - 1)) print_error("[read_constraints_coefficients]: Failed to obtain columns info.\n");
+	inst->cmatbeg[inst->ncols] = inst->nzcnt;
+}
+
+// [EXTENSION]
+void build_row_view(INSTANCE* inst) {
+
+	int num_chunks; /**< Number of chunks of columns transposed in parallel. */
+	int chunk;      /**< Number of columns of each chunk. */
+	nzind_t* count; /**< Nonzeros of each row in each chunk, then their first positions in the row view (num_chunks x nrows). */
+	nzind_t pos;    /**< Current position in the row view. */
+	nzind_t c;      /**< Support variable. */
+
+	// Row view already available
+	if (inst->rmatbeg != NULL) return;
+
+	// Allocate (the counters never take more memory than the row indices of the view)
+	num_chunks = (int)max(1, min(ROW_VIEW_CHUNKS, inst->nzcnt / max(inst->nrows, 1)));
+	chunk = (inst->ncols + num_chunks - 1) / num_chunks;
+	inst->rmatbeg = (nzind_t*)malloc(((size_t)inst->nrows + 1) * sizeof(nzind_t));
+	inst->rmatind = (int*)malloc((size_t)max(inst->nzcnt, 1) * sizeof(int));
+	inst->rmatval = (double*)malloc((size_t)max(inst->nzcnt, 1) * sizeof(double));
+	count = (nzind_t*)calloc((size_t)num_chunks * inst->nrows, sizeof(nzind_t));
+	if (inst->rmatbeg == NULL || inst->rmatind == NULL || inst->rmatval == NULL || count == NULL) print_error("[build_row_view]: Failed to allocate row view.\n");
+
+	// Count the nonzeros of each row in each chunk of columns (chunks in parallel)
+	#pragma omp parallel for schedule(static, 1)
+	for (int t = 0; t < num_chunks; t++) {
+		nzind_t* cnt = &(count[(size_t)t * inst->nrows]);
+		for (int j = t * chunk; j < min((t + 1) * chunk, inst->ncols); j++) {
+			COL_ITER col; int rowind; double aij;
+			for (col_begin(inst, j, &col); col_next(&col, &rowind, &aij); ) cnt[rowind]++;
+		}
+	}
+
+	// Row begin indices and first position of each chunk in each row (chunks in column order)
+	pos = 0;
+	for (int i = 0; i < inst->nrows; i++) {
+		inst->rmatbeg[i] = pos;
+		for (int t = 0; t < num_chunks; t++) {
+			c = count[(size_t)t * inst->nrows + i];
+			count[(size_t)t * inst->nrows + i] = pos;
+			pos += c;
+		}
+	}
+	assert(pos == inst->nzcnt);
+	inst->rmatbeg[inst->nrows] = inst->nzcnt;
+
+	// Place the nonzeros (chunks in parallel, column indices in increasing order within each row)
+	#pragma omp parallel for schedule(static, 1)
+	for (int t = 0; t < num_chunks; t++) {
+		nzind_t* cnt = &(count[(size_t)t * inst->nrows]);
+		for (int j = t * chunk; j < min((t + 1) * chunk, inst->ncols); j++) {
+			COL_ITER col; int rowind; double aij;
+			for (col_begin(inst, j, &col); col_next(&col, &rowind, &aij); ) {
+				nzind_t h = cnt[rowind]++;
+				inst->rmatind[h] = j;
+				inst->rmatval[h] = aij;
+			}
+		}
 	}
 
-	// Get constraint matrix, both by rows and by columns
-	if (CPXgetrows(inst->env, inst->lp, &unused, inst->rmatbeg, inst->rmatind, inst->rmatval, inst->nzcnt, &unused, 0, inst->nrows - 1)) print_error("[read_constraints_coefficients]: Failed to obtain rows info.\n");
-	if (CPXgetcols(inst->env, inst->lp, &unused, inst->cmatbeg, inst->cmatind, inst->cmatval, inst->nzcnt, &unused, 0, inst->ncols - 1)) print_error("[read_constraints_coefficients]: Failed to obtain columns info.\n");
+	// Free
+	free(count);
+
+	print_verbose(100, "[build_row_view]: Row view of the constraint matrix built (" NZ_FMT " nonzeros, %d chunks).\n", inst->nzcnt, num_chunks);
 }
 
 void read_constraints_senses(INSTANCE* inst) {
@@ -166,25 +261,38 @@ void read_constraints_right_hand_sides(INSTANCE* inst) {
 
 void read_row_slacks(INSTANCE* inst) {
 
-	// Allocate row slacks
-	inst->slack = (double*)malloc(inst->nrows * sizeof(double)); if (inst->slack == NULL) print_error("[read_row_slacks]: Failed to allocate row slacks.\n");
+	double* slack; /**< Row slacks (as returned by CPLEX). */
+
+	// Allocate row slacks and row records
+	slack = (double*)malloc(inst->nrows * sizeof(double));
+	inst->rows = (ROW_STATE*)malloc(inst->nrows * sizeof(ROW_STATE)); if (slack == NULL || inst->rows == NULL) print_error("[read_row_slacks]: Failed to allocate row slacks.\n");
 
 	// Get row slacks
-	if (CPXgetslack(inst->env, inst->lp, inst->slack, 0, inst->nrows - 1)) print_error("[read_row_slacks]: Failed to obtain slacks.\n");
-	//assert(valid_row_slacks(inst->slack, inst->sense, inst->nrows));
+	if (CPXgetslack(inst->env, inst->lp, slack, 0, inst->nrows - 1)) print_error("[read_row_slacks]: Failed to obtain slacks.\n");
+	//assert(valid_row_slacks(slack, inst->sense, inst->nrows));
+
+	// Pack the row records (singletons slacks rooms are set by compute_singletons_slacks)
+	for (int i = 0; i < inst->nrows; i++) {
+		inst->rows[i].slack = slack[i];
+		inst->rows[i].ss_down = 0.0;
+		inst->rows[i].ss_up = 0.0;
+		inst->rows[i].sense = inst->sense[i];
+		inst->rows[i].has_ss = 0;
+		inst->rows[i].integral = 0;
+	}
 
 	// [DEBUG ONLY] Reject instances with ranged constraints or wrong row slacks
 	for (int i = 0; i < inst->nrows; i++) {
 
 		switch (inst->sense[i]) {
 			case 'L': // row slack must be non-negative
-				if (inst->slack[i] < -(TOLERANCE)) print_error("[read_row_slacks]: Found 'L' constraint with row slack %f\n", inst->slack[i]);
+				if (slack[i] < -(TOLERANCE)) print_error("[read_row_slacks]: Found 'L' constraint with row slack %f\n", slack[i]);
 				break;
 			case 'G': // row slack must be non-positive
-				if (inst->slack[i] > TOLERANCE) print_error("[read_row_slacks]: Found 'G' constraint with row slack %f\n", inst->slack[i]);
+				if (slack[i] > TOLERANCE) print_error("[read_row_slacks]: Found 'G' constraint with row slack %f\n", slack[i]);
 				break;
 			case 'E': // row slack must be zero
-				if (fabs(inst->slack[i]) > TOLERANCE) print_error("[read_row_slacks]: Found 'E' constraint with row slack %f\n", inst->slack[i]);
+				if (fabs(slack[i]) > TOLERANCE) print_error("[read_row_slacks]: Found 'E' constraint with row slack %f\n", slack[i]);
 				break;
 			case 'R':
 				print_error("[read_row_slacks]: Ranged constraints (type 'R') not supported.\n");
@@ -194,43 +302,51 @@ void read_row_slacks(INSTANCE* inst) {
 				break;
 		}
 	}
+
+	// Free
+	free(slack);
 }
 
 // [EXTENSION]
 void find_singletons(INSTANCE* inst) {
 
-	int colend;    /**< Index of the last constraint containing variable x_j. */
-	int rowind;	   /**< Index of the current constraint. */
-	int* count;    /**< Support structure for counting singletons for each row. */
-	int first = 0; /**< Support flag. */
-	int prev = -1; /**< Index of previous row with beg index. */
-	int index;     /**< Index of the current singleton. */
-	int beg;       /**< Index of the first singleton of a given row. */
-	int offset;    /**< Offset for a singleton of a given row. */
+	nzind_t colend;      /**< Index of the last constraint containing variable x_j. */
+	int rowind;	         /**< Index of the current constraint. */
+	double aij;          /**< Coefficient of x_j in the current constraint. */
+	COL_ITER col;        /**< Iterator over the constraints containing variable x_j. */
+	int* singleton_row;  /**< Row of each singleton (-1 for the other variables). */
+	double* singleton_coef; /**< Coefficient of each singleton in its row. */
+	int* cursor;         /**< Next free position of the singletons of each row. */
+	int beg;             /**< Index of the first singleton of a given row. */
 
 	// Allocate
 	inst->num_singletons = (int*)calloc((size_t)inst->nrows, sizeof(int)); 
-	count = (int*)calloc((size_t)inst->nrows, sizeof(int)); if (inst->num_singletons == NULL || count == NULL) print_error("[find_singletons][singletons]: Failed to allocate num_singletons or count.\n");
+	singleton_row = (int*)malloc((size_t)inst->ncols * sizeof(int));
+	singleton_coef = (double*)malloc((size_t)inst->ncols * sizeof(double)); if (inst->num_singletons == NULL || singleton_row == NULL || singleton_coef == NULL) print_error("[find_singletons][singletons]: Failed to allocate num_singletons or singleton rows.\n");
 
-	// Count number of singletons for each row (scan continuous variables)
+	// Find the singletons and count them for each row, in a single pass over the columns (scan continuous variables)
 	inst->rs_size = 0; // Total number of singletons
 	for (int j = 0; j < inst->ncols; j++) {
-		
+
+		singleton_row[j] = -1;
+
 		// Skip non-continuous variables and FIXED variables (lb = ub)
 		if ((inst->vartype[j] != CPX_CONTINUOUS) || equals(inst->lb[j], inst->ub[j])) continue;
 		assert(var_type_continuous(inst->vartype[j]));
 
 		// Row index of the last constraint in which x_j appears
-		colend = (j < inst->ncols - 1) ? inst->cmatbeg[j + 1] : inst->nzcnt;
+		colend = inst->cmatbeg[j + 1];
 
 		// If the variable appears in only one constraint
 		if (inst->cmatbeg[j] == colend - 1) {
 
-			rowind = inst->cmatind[inst->cmatbeg[j]];
+			col_begin(inst, j, &col);
+			col_next(&col, &rowind, &aij);
 			assert(index_in_bounds(rowind, inst->nrows));
-			print_verbose(200, "[find_singletons][singletons]: x_%d = %f in constraint %d ('%c')\n", j + 1, inst->x[j], rowind, inst->sense[rowind]);
+			print_verbose(200, "[find_singletons][singletons]: x_%d = %f in constraint %d ('%c')\n", j + 1, inst->x[j], orig_row(inst, rowind), inst->sense[rowind]);
+			singleton_row[j] = rowind;
+			singleton_coef[j] = aij;
 			inst->num_singletons[rowind]++;
-			count[rowind]++;
 			inst->rs_size++;
 		}
 	}
@@ -238,68 +354,41 @@ void find_singletons(INSTANCE* inst) {
 	print_verbose(120, "[find_singletons][singletons]: Total number of singletons = %d\n", inst->rs_size);
 
 	// Allocate / Initialize
-	inst->row_singletons = (int*)malloc((size_t)inst->rs_size * sizeof(int));
+	inst->row_singletons = (int*)malloc((size_t)max(inst->rs_size, 1) * sizeof(int));
 	inst->rs_beg = (int*)malloc((size_t)inst->nrows * sizeof(int));
-	inst->rs_coef = (double*)calloc((size_t)inst->rs_size, sizeof(double)); if (inst->row_singletons == NULL || inst->rs_beg == NULL || inst->rs_coef == NULL) print_error("[find_singletons]: Failed to allocate row_singletons or rs_beg or rs_coef\n");
-	for (int k = 0; k < inst->rs_size; k++) inst->row_singletons[k] = -1;
-	for (int i = 0; i < inst->nrows; i++) inst->rs_beg[i] = -1;
+	inst->rs_coef = (double*)calloc((size_t)max(inst->rs_size, 1), sizeof(double));
+	cursor = (int*)malloc((size_t)inst->nrows * sizeof(int)); if (inst->row_singletons == NULL || inst->rs_beg == NULL || inst->rs_coef == NULL || cursor == NULL) print_error("[find_singletons]: Failed to allocate row_singletons or rs_beg or rs_coef\n");
 
-	// Populate row singletons begin indices
+	// Populate row singletons begin indices (prefix sums of the counts, -1 for rows with no singletons)
+	beg = 0;
 	for (int i = 0; i < inst->nrows; i++) {
+		inst->rs_beg[i] = (inst->num_singletons[i] > 0) ? beg : -1;
+		cursor[i] = beg;
+		beg += inst->num_singletons[i];
 
-		// Skip rows that have no singletons
-		if (inst->num_singletons[i] == 0) continue;
-		assert(positive_integer(inst->num_singletons[i]));
-
-		if (first == 0) {
-			inst->rs_beg[i] = 0;
-			first = 1;
-			prev = i;
-		}
-		else {
-			index = inst->rs_beg[prev] + inst->num_singletons[prev]; 
-			assert(index_in_bounds(index, inst->rs_size));
-			inst->rs_beg[i] = index;
-			prev = i;
-		}
-		
 		// [DEBUG ONLY] Print row singletons begin indices
-		print_verbose(200, "[DEBUG][find_singletons][singletons]: Row %d | %d singletons | rs_beg = %d\n", i, inst->num_singletons[i], inst->rs_beg[i]);
+		if (inst->num_singletons[i] > 0) print_verbose(200, "[DEBUG][find_singletons][singletons]: Row %d | %d singletons | rs_beg = %d\n", orig_row(inst, i), inst->num_singletons[i], inst->rs_beg[i]);
 	}
+	assert(beg == inst->rs_size);
 	// [DEBUG ONLY] Print size of row singletons array
 	print_verbose(200, "[DEBUG][find_singletons][singletons]: rs_size = %d\n", inst->rs_size);
 
-	// Populate singleton indices and coefficients for each row
+	// Populate singleton indices and coefficients for each row (counting sort by row, columns in index order)
 	for (int j = 0; j < inst->ncols; j++) {
 
-		// Skip non-continuous variables and FIXED variables (lb = ub)
-		if ((inst->vartype[j] != CPX_CONTINUOUS) || equals(inst->lb[j], inst->ub[j])) continue;
-		assert(var_type_continuous(inst->vartype[j]));
-
-		colend = (j < inst->ncols - 1) ? inst->cmatbeg[j + 1] : inst->nzcnt;
-
-		// If the variable appears in only one constraint
-		if (inst->cmatbeg[j] == colend - 1) {
-
-			rowind = inst->cmatind[colend - 1];                    
-			assert(index_in_bounds(rowind, inst->nrows));
-
-			offset = inst->num_singletons[rowind] - count[rowind]; 
-			assert(non_negative_integer(offset));
-
-			beg = inst->rs_beg[rowind];                            
-			assert(index_in_bounds(beg + offset, inst->rs_size));
+		if (singleton_row[j] < 0) continue;
+		rowind = singleton_row[j];
+		assert(index_in_bounds(cursor[rowind], inst->rs_size));
 
-			inst->row_singletons[beg + offset] = j;
-			inst->rs_coef[beg + offset] = inst->cmatval[colend - 1];
-			count[rowind]--;
-		}
+		inst->row_singletons[cursor[rowind]] = j;
+		inst->rs_coef[cursor[rowind]] = singleton_coef[j];
+		cursor[rowind]++;
 	}
-	assert(array_of_zeros(count, inst->nrows));
-	free(count);
+	free_all(3, singleton_row, singleton_coef, cursor);
 
-	// Sort singletons of each row by lowest objective function coefficient
+	// Sort singletons of each row by lowest objective function coefficient (rows in parallel)
 	if (inst->sort_singletons) {
+		#pragma omp parallel for schedule(dynamic, 64)
 		for (int i = 0; i < inst->nrows; i++) {
 
 			// Skip rows that have no singletons
@@ -315,7 +404,7 @@ void find_singletons(INSTANCE* inst) {
 	if (VERBOSE >= 201) {
 		fprintf(stdout, "\n[DEBUG][find_singletons][singletons]: Row singletons (index | coef):\n");
 		for (int i = 0; i < inst->nrows; i++) {
-			fprintf(stdout, "[DEBUG][find_singletons][singletons]: Row %d: ", i);
+			fprintf(stdout, "[DEBUG][find_singletons][singletons]: Row %d: ", orig_row(inst, i));
 			if (inst->num_singletons[i] == 0) fprintf(stdout, "-");
 			beg = inst->rs_beg[i];
 			for (int k = 0; k < inst->num_singletons[i]; k++) {
@@ -331,13 +420,15 @@ void find_singletons(INSTANCE* inst) {
 void compute_singletons_slacks(INSTANCE* inst) {
 
 	int beg;             /**< Index of the first singleton of a given row. */
-	int singleton_index; /**< Absolute index of the current singleton. */
-	double coef;         /**< Coefficient of the current singleton (in its row). */
+	SINGLETON* s;        /**< Record of the current singleton. */
 
 	// Allocate
+	inst->rs_rec = (SINGLETON*)malloc((size_t)max(inst->rs_size, 1) * sizeof(SINGLETON)); if (inst->rs_rec == NULL) print_error("[compute_singletons_slacks][singletons]: Failed to allocate singleton records.\n");
 	inst->ss_val = (double*)calloc((size_t)inst->nrows, sizeof(double));
 	inst->ss_ub = (double*)calloc((size_t)inst->nrows, sizeof(double));
-	inst->ss_lb = (double*)calloc((size_t)inst->nrows, sizeof(double)); if (inst->ss_val == NULL || inst->ss_ub == NULL || inst->ss_lb == NULL) print_error("[compute_singletons_slacks][singletons]: Failed to allocate singletons slacks structures.\n");
+	inst->ss_lb = (double*)calloc((size_t)inst->nrows, sizeof(double));
+	inst->rs_skip_inc = (int*)calloc((size_t)inst->nrows, sizeof(int));
+	inst->rs_skip_dec = (int*)calloc((size_t)inst->nrows, sizeof(int)); if (inst->ss_val == NULL || inst->ss_ub == NULL || inst->ss_lb == NULL || inst->rs_skip_inc == NULL || inst->rs_skip_dec == NULL) print_error("[compute_singletons_slacks][singletons]: Failed to allocate singletons slacks structures.\n");
 
 	// Scan constraints that have singletons
 	for (int i = 0; i < inst->nrows; i++) {
@@ -349,29 +440,41 @@ void compute_singletons_slacks(INSTANCE* inst) {
 		beg = inst->rs_beg[i]; 
 		assert(index_in_bounds(beg, inst->rs_size));
 
-		// Compute singletons slack value and upper/lower bounds (row i)
+		// Pack the singleton records of row i (same order of row_singletons)
 		for (int k = 0; k < inst->num_singletons[i]; k++) {
 
 			assert(index_in_bounds(beg + k, inst->rs_size));
-			singleton_index = inst->row_singletons[beg + k]; 
-			assert(index_in_bounds(singleton_index, inst->ncols));
-			coef = inst->rs_coef[beg + k];
+			s = &(inst->rs_rec[beg + k]);
+			s->col = inst->row_singletons[beg + k];
+			assert(index_in_bounds(s->col, inst->ncols));
+			s->coef = inst->rs_coef[beg + k];
+			s->lb = inst->lb[s->col];
+			s->ub = inst->ub[s->col];
+			s->obj = inst->obj[s->col];
+			s->val = inst->x[s->col];
+		}
 
-			inst->ss_val[i] += (coef * inst->x[singleton_index]);
+		// Compute singletons slack value and upper/lower bounds (row i, sequential over the records)
+		for (int k = 0; k < inst->num_singletons[i]; k++) {
+
+			s = &(inst->rs_rec[beg + k]);
+			inst->ss_val[i] += (s->coef * s->val);
 
-			if (coef > 0.0) {
-				inst->ss_ub[i] += (coef * inst->ub[singleton_index]);
-				inst->ss_lb[i] += (coef * inst->lb[singleton_index]);
+			if (s->coef > 0.0) {
+				inst->ss_ub[i] += (s->coef * s->ub);
+				inst->ss_lb[i] += (s->coef * s->lb);
 			}
-			if (coef < 0.0) {
-				inst->ss_ub[i] += (coef * inst->lb[singleton_index]);
-				inst->ss_lb[i] += (coef * inst->ub[singleton_index]);
+			if (s->coef < 0.0) {
+				inst->ss_ub[i] += (s->coef * s->lb);
+				inst->ss_lb[i] += (s->coef * s->ub);
 			}
 		}
 		assert(var_in_bounds(inst->ss_val[i], inst->ss_lb[i], inst->ss_ub[i]));
+		inst->rows[i].has_ss = 1;
+		refresh_row_singletons(inst, i);
 
 		// [DEBUG ONLY] Print singletons slacks bounds
-		print_verbose(200, "[DEBUG][compute_singletons_slacks][singletons][row %d]: ss_lb = %f | ss_val = %f | ss_ub = %f\n", i + 1, inst->ss_lb[i], inst->ss_val[i], inst->ss_ub[i]);
+		print_verbose(200, "[DEBUG][compute_singletons_slacks][singletons][row %d]: ss_lb = %f | ss_val = %f | ss_ub = %f\n", orig_row(inst, i) + 1, inst->ss_lb[i], inst->ss_val[i], inst->ss_ub[i]);
 	}
 	assert(valid_bounds(inst->ss_lb, inst->ss_ub, inst->nrows));
 }
@@ -379,23 +482,104 @@ void compute_singletons_slacks(INSTANCE* inst) {
 // [EXTENSION]
 void sort_singletons(int start, int end, int* rs_ind, double* rs_coef, double* obj) {
 
-	int min_idx;      /**< Index of the current minimum element. */
-	int temp_ind;     /**< Support variable. */
-	double temp_coef; /**< Support variable. */
+	SINGLETON_KEY* keys; /**< Sort keys of the singletons of the row. */
+
+	if (end - start < 2) return;
+
+	// Allocate
+	keys = (SINGLETON_KEY*)malloc((size_t)(end - start) * sizeof(SINGLETON_KEY)); if (keys == NULL) print_error("[sort_singletons]: Failed to allocate sort keys.\n");
+
+	// Sort subarrays of rs_ind and rs_coef between indices start/end (by objective coefficient, then by column index)
+	for (int k = start; k < end; k++) {
+		keys[k - start].obj = obj[rs_ind[k]];
+		keys[k - start].col = rs_ind[k];
+		keys[k - start].coef = rs_coef[k];
+	}
+	qsort(keys, (size_t)(end - start), sizeof(SINGLETON_KEY), compare_singleton_keys);
+	for (int k = start; k < end; k++) {
+		rs_ind[k] = keys[k - start].col;
+		rs_coef[k] = keys[k - start].coef;
+	}
+
+	// Free
+	free(keys);
+}
+
+// [EXTENSION]
+int compare_singleton_keys(const void* a, const void* b) {
+
+	const SINGLETON_KEY* ka = (const SINGLETON_KEY*)a; /**< First key. */
+	const SINGLETON_KEY* kb = (const SINGLETON_KEY*)b; /**< Second key. */
+
+	if (ka->obj != kb->obj) return (ka->obj > kb->obj) - (ka->obj < kb->obj);
+	return (ka->col > kb->col) - (ka->col < kb->col);
+}
+
+// [EXTENSION]
+void find_movable_columns(INSTANCE* inst) {
+
+	COL_ITER col; /**< Iterator over the constraints containing variable x_j. */
+	int rowind; /**< Index of the current constraint. */
+	double aij; /**< Coefficient of x_j in the current constraint (unused). */
+	int fixed;  /**< Flag set to 1 iff variable x_j appears in an equality constraint with no singletons. */
+
+	// Allocate
+	inst->movable = (int*)malloc(inst->ncols * sizeof(int)); if (inst->movable == NULL) print_error("[find_movable_columns]: Failed to allocate movable columns.\n");
+	inst->num_movable = 0;
 
-	// Sort subarrays of rs_ind and rs_coef between indices start/end
-	for (int i = start; i < end - 1; i++) {
+	for (int j = 0; j < inst->ncols; j++) {
 
-		min_idx = i;
+		// Skip non-integer variables and FIXED variables
+		if (!(inst->int_var[j]) || equals(inst->lb[j], inst->ub[j])) continue;
 
-		// Find the index minimum element in the sub-subarray
-		for (int j = i + 1; j < end; j++) {
-			if (obj[rs_ind[j]] < obj[rs_ind[min_idx]]) min_idx = j;
+		// Skip variables in an equality constraint with no singletons (delta_updown always sets both deltas to zero)
+		fixed = 0;
+		for (col_begin(inst, j, &col); col_next(&col, &rowind, &aij); ) {
+			if ((inst->sense[rowind] == 'E') && !(inst->singletons && inst->num_singletons[rowind] > 0)) { fixed = 1; break; }
 		}
+		if (fixed) continue;
 
-		// Swap min_idx <--> i (both arrays)
-		temp_ind = rs_ind[min_idx];   temp_coef = rs_coef[min_idx];
-		rs_ind[min_idx] = rs_ind[i];  rs_coef[min_idx] = rs_coef[i];
-		rs_ind[i] = temp_ind;         rs_coef[i] = temp_coef;
+		inst->movable[inst->num_movable++] = j;
 	}
-}
\ No newline at end of file
+	print_verbose(10, "[find_movable_columns]: %d movable integer columns out of %d columns.\n", inst->num_movable, inst->ncols);
+}
+
+// [EXTENSION]
+void find_integral_rows(INSTANCE* inst) {
+
+	COL_ITER col;     /**< Iterator over the constraints containing variable x_j. */
+	int rowind;       /**< Index of the current constraint. */
+	double aij;       /**< Coefficient of x_j in the current constraint. */
+	double* bound;    /**< Largest magnitude of the activity of each row (sum of |aij| times the largest bound magnitude of x_j). */
+	int num_integral; /**< Number of integral rows. */
+
+	// Allocate
+	bound = (double*)malloc((size_t)max(inst->nrows, 1) * sizeof(double)); if (bound == NULL) print_error("[find_integral_rows]: Failed to allocate row activity bounds.\n");
+
+	// Candidates: rows with integer right hand side and no singletons
+	for (int i = 0; i < inst->nrows; i++) {
+		inst->rows[i].integral = (!(inst->rows[i].has_ss) && (inst->rhs[i] == floor(inst->rhs[i])));
+		bound[i] = fabs(inst->rhs[i]);
+	}
+
+	// Discard the rows with a non-integer coefficient or column, or a column with an infinite bound
+	for (int j = 0; j < inst->ncols; j++) {
+		for (col_begin(inst, j, &col); col_next(&col, &rowind, &aij); ) {
+			if (!(inst->rows[rowind].integral)) continue;
+			if (!(inst->int_var[j]) || (aij != floor(aij)) || (fabs(inst->lb[j]) >= CPX_INFBOUND) || (fabs(inst->ub[j]) >= CPX_INFBOUND)) inst->rows[rowind].integral = 0;
+			else bound[rowind] += fabs(aij) * max(fabs(inst->lb[j]), fabs(inst->ub[j]));
+		}
+	}
+
+	// Discard the rows whose activities may not be exact
+	num_integral = 0;
+	for (int i = 0; i < inst->nrows; i++) {
+		if (inst->rows[i].integral && (bound[i] > INT_ROW_MAX)) inst->rows[i].integral = 0;
+		num_integral += inst->rows[i].integral;
+	}
+
+	// Free
+	free(bound);
+
+	print_verbose(10, "[find_integral_rows]: %d integral rows out of %d rows.\n", num_integral, inst->nrows);
+}
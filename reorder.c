@@ -0,0 +1,183 @@
+/**
+ * @file reorder.c
+ * @author Ivan Viviani
+ * @copyright Copyright (c) 2020
+ */
+
+#include "ziround.h"
+
+void reorder_rows(INSTANCE* inst) {
+
+	nzind_t* rbeg;      /**< Begin index of the columns of each row (nrows + 1 entries). */
+	int* rcol;          /**< Columns of each row. */
+	int* start;         /**< Rows by increasing degree (candidate starts of the visit). */
+	int* order;         /**< Rows in Cuthill-McKee order (breadth-first visit). */
+	int* newrow;        /**< Position of each row in the visit (-1 if not reached yet), then its new index. */
+	char* colseen;      /**< Flags of the columns already expanded by the visit. */
+	long long* key;     /**< Sort keys of the rows (degree, then index). */
+	nzind_t pos;        /**< Support variable. */
+	int head;           /**< Next row of the visit to expand. */
+	int tail;           /**< Number of rows already reached by the visit. */
+	int next_start;     /**< Next candidate start row (index in start). */
+	int first;          /**< First row reached by the current expansion. */
+	double span_before; /**< Average row index span of the columns before the reordering. */
+
+	if (!(inst->rcm)) return;
+
+	// Allocate
+	rbeg = (nzind_t*)calloc((size_t)inst->nrows + 1, sizeof(nzind_t));
+	rcol = (int*)malloc((size_t)inst->nzcnt * sizeof(int));
+	start = (int*)malloc((size_t)inst->nrows * sizeof(int));
+	order = (int*)malloc((size_t)inst->nrows * sizeof(int));
+	newrow = (int*)malloc((size_t)inst->nrows * sizeof(int));
+	colseen = (char*)calloc((size_t)inst->ncols, sizeof(char));
+	key = (long long*)malloc((size_t)inst->nrows * sizeof(long long));
+	if (rbeg == NULL || rcol == NULL || start == NULL || order == NULL || newrow == NULL || colseen == NULL || key == NULL) print_error("[reorder_rows]: Failed to allocate row ordering structures.\n");
+
+	// Columns of each row (transpose of the row indices, no coefficients)
+	for (nzind_t k = 0; k < inst->nzcnt; k++) rbeg[inst->cmatind[k] + 1]++;
+	for (int i = 0; i < inst->nrows; i++) rbeg[i + 1] += rbeg[i];
+	for (int j = 0; j < inst->ncols; j++) {
+		for (nzind_t k = inst->cmatbeg[j]; k < inst->cmatbeg[j + 1]; k++) {
+			pos = rbeg[inst->cmatind[k]]++;
+			rcol[pos] = j;
+		}
+	}
+	for (int i = inst->nrows; i > 0; i--) rbeg[i] = rbeg[i - 1];
+	rbeg[0] = 0;
+
+	// Start rows of the connected components: increasing degree (number of nonzeros)
+	for (int i = 0; i < inst->nrows; i++) start[i] = i;
+	sort_by_degree(start, inst->nrows, rbeg, key);
+
+	// Cuthill-McKee: breadth-first visit of the row intersection graph (rows sharing a column), reaching the
+	// rows through the columns (each column expanded once), the rows reached by each expansion by increasing degree
+	for (int i = 0; i < inst->nrows; i++) newrow[i] = -1;
+	head = 0; tail = 0; next_start = 0;
+	while (tail < inst->nrows) {
+
+		while (newrow[start[next_start]] >= 0) next_start++;
+		newrow[start[next_start]] = tail;
+		order[tail++] = start[next_start];
+
+		while (head < tail) {
+
+			int r = order[head++];
+			first = tail;
+			for (nzind_t h = rbeg[r]; h < rbeg[r + 1]; h++) {
+				int j = rcol[h];
+				if (colseen[j]) continue;
+				colseen[j] = 1;
+				for (nzind_t k = inst->cmatbeg[j]; k < inst->cmatbeg[j + 1]; k++) {
+					if (newrow[inst->cmatind[k]] >= 0) continue;
+					newrow[inst->cmatind[k]] = tail;
+					order[tail++] = inst->cmatind[k];
+				}
+			}
+			sort_by_degree(&(order[first]), tail - first, rbeg, key);
+		}
+	}
+	assert(tail == inst->nrows);
+
+	// Reverse Cuthill-McKee: new index of each row
+	for (int p = 0; p < inst->nrows; p++) newrow[order[p]] = inst->nrows - 1 - p;
+
+	// Apply the new row indices
+	span_before = column_span(inst);
+	permute_rows(inst, newrow);
+	print_verbose(10, "[reorder_rows]: Average row index span of the columns %.1f -> %.1f.\n", span_before, column_span(inst));
+
+	// Free
+	free_all(7, rbeg, rcol, start, order, newrow, colseen, key);
+}
+
+void sort_by_degree(int* rows, int len, nzind_t* rbeg, long long* key) {
+
+	if (len < 2) return;
+
+	// Keys: degree in the high bits, row index in the low bits (ties by row index)
+	for (int a = 0; a < len; a++) key[a] = ((long long)(rbeg[rows[a] + 1] - rbeg[rows[a]]) << 32) | rows[a];
+	qsort(key, (size_t)len, sizeof(long long), compare_row_keys);
+	for (int a = 0; a < len; a++) rows[a] = (int)(key[a] & 0xFFFFFFFF);
+}
+
+void permute_rows(INSTANCE* inst, int* newrow) {
+
+	NONZERO* nz;     /**< Nonzeros of the current column. */
+	ROW_STATE* rows; /**< Row records in the new order. */
+	char* sense;     /**< Constraint senses in the new order. */
+	double* rhs;     /**< Right hand sides in the new order. */
+	int* row_orig;   /**< Original index of each row in the new order. */
+	nzind_t len;     /**< Number of nonzeros of the current column. */
+	nzind_t maxlen;  /**< Largest number of nonzeros of a column. */
+
+	// Allocate
+	maxlen = 1;
+	for (int j = 0; j < inst->ncols; j++) maxlen = max(maxlen, inst->cmatbeg[j + 1] - inst->cmatbeg[j]);
+	nz = (NONZERO*)malloc((size_t)maxlen * sizeof(NONZERO));
+	rows = (ROW_STATE*)malloc((size_t)inst->nrows * sizeof(ROW_STATE));
+	sense = (char*)malloc((size_t)inst->nrows * sizeof(char));
+	rhs = (double*)malloc((size_t)inst->nrows * sizeof(double));
+	row_orig = (int*)malloc((size_t)max(inst->nrows, 1) * sizeof(int));
+	if (nz == NULL || rows == NULL || sense == NULL || rhs == NULL || row_orig == NULL) print_error("[permute_rows]: Failed to allocate permuted rows.\n");
+
+	// Columns: new row indices, in increasing order within each column
+	for (int j = 0; j < inst->ncols; j++) {
+		len = inst->cmatbeg[j + 1] - inst->cmatbeg[j];
+		for (nzind_t k = 0; k < len; k++) {
+			nz[k].ind = newrow[inst->cmatind[inst->cmatbeg[j] + k]];
+			nz[k].val = inst->cmatval[inst->cmatbeg[j] + k];
+		}
+		qsort(nz, (size_t)len, sizeof(NONZERO), compare_nonzeros);
+		for (nzind_t k = 0; k < len; k++) {
+			inst->cmatind[inst->cmatbeg[j] + k] = nz[k].ind;
+			inst->cmatval[inst->cmatbeg[j] + k] = nz[k].val;
+		}
+	}
+
+	// Row data
+	for (int i = 0; i < inst->nrows; i++) {
+		rows[newrow[i]] = inst->rows[i];
+		sense[newrow[i]] = inst->sense[i];
+		rhs[newrow[i]] = inst->rhs[i];
+		row_orig[newrow[i]] = orig_row(inst, i);
+	}
+	free_all(4, inst->rows, inst->sense, inst->rhs, inst->row_orig);
+	inst->rows = rows; inst->sense = sense; inst->rhs = rhs; inst->row_orig = row_orig;
+
+	// Row view: built again from the columns (same order as the one read from CPLEX)
+	if (inst->rmatbeg != NULL) {
+		free_all(3, inst->rmatbeg, inst->rmatind, inst->rmatval);
+		inst->rmatbeg = NULL; inst->rmatind = NULL; inst->rmatval = NULL;
+		build_row_view(inst);
+	}
+
+	// Free
+	free(nz);
+}
+
+double column_span(INSTANCE* inst) {
+
+	double span = 0.0; /**< Sum of the row index spans of the columns. */
+
+	for (int j = 0; j < inst->ncols; j++) {
+		int lo = inst->nrows, hi = -1;
+		for (nzind_t k = inst->cmatbeg[j]; k < inst->cmatbeg[j + 1]; k++) {
+			lo = min(lo, inst->cmatind[k]);
+			hi = max(hi, inst->cmatind[k]);
+		}
+		if (hi >= lo) span += (double)(hi - lo);
+	}
+
+	return span / max(inst->ncols, 1);
+}
+
+int compare_row_keys(const void* a, const void* b) {
+
+	return (*(const long long*)a > *(const long long*)b) - (*(const long long*)a < *(const long long*)b);
+}
+
+int compare_nonzeros(const void* a, const void* b) {
+
+	return (((const NONZERO*)a)->ind > ((const NONZERO*)b)->ind) - (((const NONZERO*)a)->ind < ((const NONZERO*)b)->ind);
+}
@@ -0,0 +1,259 @@
+/**
+ * @file sell.c
+ * @author Ivan Viviani
+ * @copyright Copyright (c) 2020
+ */
+
+#include "ziround.h"
+
+void load_sell(INSTANCE* inst) {
+
+	int* cols;                      /**< Columns that can be candidates of the 1-opt phase. */
+	int num_cols;                   /**< Number of columns copied. */
+	LARGE_INTEGER freq, start, end; /**< Variables for measuring execution time of the build. */
+
+	if (!(inst->sell_oneopt && inst->one_opt && inst->shift_nonfracvars)) return;
+
+	QueryPerformanceFrequency(&freq);
+	QueryPerformanceCounter(&start);
+
+	// Integer columns not fixed and with a nonzero objective coefficient (the integrality of x is checked at evaluation time)
+	cols = (int*)malloc((size_t)max(inst->ncols, 1) * sizeof(int)); if (cols == NULL) print_error("[load_sell]: Failed to allocate candidate columns.\n");
+	num_cols = 0;
+	for (int j = 0; j < inst->ncols; j++) {
+		if (inst->int_var[j] && !equals(inst->lb[j], inst->ub[j]) && !zero(inst->obj[j])) cols[num_cols++] = j;
+	}
+	sell_build(inst, &(inst->sell), cols, num_cols);
+
+	QueryPerformanceCounter(&end);
+	print_verbose(10, "[load_sell]: Sliced ELLPACK copy of %d columns built in %.3f ms.\n", num_cols,
+		(double)(end.QuadPart - start.QuadPart) * 1000.0 / (double)freq.QuadPart);
+
+	// Free
+	free(cols);
+}
+
+void sell_gains(INSTANCE* inst, double* gain, double* delta_up, double* delta_down) {
+
+	SELL sell;      /**< Layout of the instance (shared), with private rooms of the rows. */
+	int c;          /**< Index of the current chunk. */
+
+	if (inst->sell.col == NULL) print_error("[sell_gains]: Sliced ELLPACK copy not built.\n");
+
+	// Rooms of the rows (private, the clones of a multi-start run share the layout)
+	sell = inst->sell;
+	sell.room_up = (double*)malloc(((size_t)inst->nrows + 1) * sizeof(double));
+	sell.room_down = (double*)malloc(((size_t)inst->nrows + 1) * sizeof(double));
+	sell.exact = (char*)malloc(((size_t)inst->nrows + 1) * sizeof(char));
+	if (sell.room_up == NULL || sell.room_down == NULL || sell.exact == NULL) print_error("[sell_gains]: Failed to allocate row rooms.\n");
+	sell_rooms(inst, &sell);
+
+	// Evaluate the chunks in parallel (each chunk writes only the entries of its columns)
+	#pragma omp parallel for schedule(dynamic, 32)
+	for (c = 0; c < sell.num_chunks; c++) {
+		sell_deltas(inst, &sell, c, delta_up, delta_down);
+		for (int lane = 0; lane < SELL_C; lane++) {
+			int j = sell.col[c * SELL_C + lane];
+			if ((j >= 0) && oneopt_candidate(inst, j)) gain[j] = oneopt_shift_gain(inst, j, delta_up[j], delta_down[j]);
+		}
+	}
+
+	// Free
+	free_all(3, sell.room_up, sell.room_down, sell.exact);
+}
+
+void sell_build(INSTANCE* inst, SELL* sell, int* cols, int num_cols) {
+
+	long long* key;   /**< Sort keys of the columns (decreasing length, then index). */
+	int* sorted;      /**< Columns sorted by length within each window. */
+	COL_ITER col;     /**< Iterator over the constraints containing the current variable. */
+	int rowind;       /**< Current row index. */
+	double aij;       /**< Current constraint coefficient. */
+	nzind_t len;      /**< Number of nonzeros of the current column. */
+	nzind_t size;     /**< Number of entries of the layout (padding included). */
+	nzind_t nnz;      /**< Number of nonzeros of the columns. */
+	nzind_t pos;      /**< Position of the current entry. */
+	int k;            /**< Position of the current nonzero in its column. */
+
+	sell->num_chunks = (num_cols + SELL_C - 1) / SELL_C;
+
+	// Sort the columns by decreasing length within windows of SELL_SIGMA columns (sigma), so that the
+	// columns of a chunk have similar lengths and little padding, while the column order is kept overall
+	key = (long long*)malloc((size_t)max(num_cols, 1) * sizeof(long long));
+	sorted = (int*)malloc((size_t)max(num_cols, 1) * sizeof(int));
+	if (key == NULL || sorted == NULL) print_error("[sell_build]: Failed to allocate sort keys.\n");
+	for (int a = 0; a < num_cols; a++) {
+		len = inst->cmatbeg[cols[a] + 1] - inst->cmatbeg[cols[a]];
+		key[a] = ((long long)(inst->nrows - len) << 32) | cols[a];
+	}
+	for (int w = 0; w < num_cols; w += SELL_SIGMA) qsort(&(key[w]), (size_t)min(SELL_SIGMA, num_cols - w), sizeof(long long), compare_row_keys);
+	for (int a = 0; a < num_cols; a++) sorted[a] = (int)(key[a] & 0xFFFFFFFF);
+
+	// Chunks: columns of each slot, lengths and begin indices
+	sell->col = (int*)malloc(((size_t)sell->num_chunks * SELL_C + 1) * sizeof(int));
+	sell->len = (int*)calloc((size_t)sell->num_chunks + 1, sizeof(int));
+	sell->beg = (nzind_t*)malloc(((size_t)sell->num_chunks + 1) * sizeof(nzind_t));
+	if (sell->col == NULL || sell->len == NULL || sell->beg == NULL) print_error("[sell_build]: Failed to allocate chunks.\n");
+	size = 0;
+	nnz = 0;
+	for (int c = 0; c < sell->num_chunks; c++) {
+		for (int lane = 0; lane < SELL_C; lane++) {
+			int a = c * SELL_C + lane;
+			sell->col[a] = (a < num_cols) ? sorted[a] : -1;
+			if (a >= num_cols) continue;
+			len = inst->cmatbeg[sorted[a] + 1] - inst->cmatbeg[sorted[a]];
+			sell->len[c] = max(sell->len[c], (int)len);
+			nnz += len;
+		}
+		sell->beg[c] = size;
+		size += (nzind_t)sell->len[c] * SELL_C;
+	}
+	sell->beg[sell->num_chunks] = size;
+
+	// Nonzeros, nonzero-major within each chunk (padding on the extra row nrows, with unit coefficient)
+	sell->ind = (int*)malloc((size_t)max(size, 1) * sizeof(int));
+	sell->val = (double*)malloc((size_t)max(size, 1) * sizeof(double));
+	if (sell->ind == NULL || sell->val == NULL) print_error("[sell_build]: Failed to allocate sliced ELLPACK columns.\n");
+	for (nzind_t p = 0; p < size; p++) { sell->ind[p] = inst->nrows; sell->val[p] = 1.0; }
+	for (int c = 0; c < sell->num_chunks; c++) {
+		for (int lane = 0; lane < SELL_C; lane++) {
+			if (sell->col[c * SELL_C + lane] < 0) continue;
+			k = 0;
+			for (col_begin(inst, sell->col[c * SELL_C + lane], &col); col_next(&col, &rowind, &aij); k++) {
+				pos = sell->beg[c] + (nzind_t)k * SELL_C + lane;
+				sell->ind[pos] = rowind;
+				sell->val[pos] = aij;
+			}
+		}
+	}
+
+	// Rooms of the rows (allocated by sell_gains for each evaluation)
+	sell->room_up = NULL;
+	sell->room_down = NULL;
+	sell->exact = NULL;
+
+	print_verbose(20, "[sell_build]: %d columns in %d chunks, %.2f padding entries per nonzero.\n", num_cols, sell->num_chunks,
+		(nnz > 0) ? (double)(size - nnz) / (double)nnz : 0.0);
+
+	// Free
+	free_all(2, key, sorted);
+}
+
+void sell_rooms(INSTANCE* inst, SELL* sell) {
+
+	ROW_STATE* row;       /**< State of the current row. */
+	double ss_delta_up;   /**< Maximum increase of the singletons slack of the current row. */
+	double ss_delta_down; /**< Maximum decrease of the singletons slack of the current row. */
+
+	for (int i = 0; i < inst->nrows; i++) {
+
+		row = &(inst->rows[i]);
+		sell->exact[i] = 0;
+
+		// Integral row with all its columns at integer values: exact floor division (scalar ratio test)
+		if (row->integral && (inst->num_nonint != NULL) && (inst->num_nonint[i] == 0)) {
+			sell->exact[i] = 1;
+			sell->room_up[i] = INFINITY;
+			sell->room_down[i] = INFINITY;
+			continue;
+		}
+
+		// Singletons slack deltas (clipped to zero if slightly negative)
+		ss_delta_up = 0.0;
+		ss_delta_down = 0.0;
+		if (row->has_ss) {
+			ss_delta_up = row->ss_up;
+			ss_delta_down = row->ss_down;
+			if ((ss_delta_up < 0.0) && (ss_delta_up > -(TOLERANCE))) ss_delta_up = 0.0;
+			if ((ss_delta_down < 0.0) && (ss_delta_down > -(TOLERANCE))) ss_delta_down = 0.0;
+		}
+
+		// Rooms of the activity: the ratio test of delta_updown divides them by |aij|
+		switch (row->sense) {
+
+			case 'L': // (slack non-negative, the singletons slack can decrease)
+				if (negative(row->slack)) print_error("[sell_rooms][row %d 'L']: Found negative row slack = %f\n", orig_row(inst, i) + 1, row->slack);
+				sell->room_up[i] = row->slack + ss_delta_down;
+				sell->room_down[i] = INFINITY;
+				break;
+
+			case 'G': // (slack non-positive, the singletons slack can increase)
+				if (positive(row->slack)) print_error("[sell_rooms][row %d 'G']: Found positive row slack = %f\n", orig_row(inst, i) + 1, row->slack);
+				sell->room_up[i] = INFINITY;
+				sell->room_down[i] = -(row->slack - ss_delta_up);
+				break;
+
+			case 'E': // (no room without singletons)
+				sell->room_up[i] = ss_delta_down;
+				sell->room_down[i] = ss_delta_up;
+				break;
+
+			default:
+				print_error("[sell_rooms]: Constraint sense '%c' not included in {'L','G','E'}.\n", row->sense);
+		}
+	}
+
+	// Padding row: no limit
+	sell->room_up[inst->nrows] = INFINITY;
+	sell->room_down[inst->nrows] = INFINITY;
+	sell->exact[inst->nrows] = 0;
+}
+
+void sell_deltas(INSTANCE* inst, SELL* sell, int c, double* delta_up, double* delta_down) {
+
+	double delta_up1[SELL_C];   /**< Row limits of the up-shift of each lane. */
+	double delta_down1[SELL_C]; /**< Row limits of the down-shift of each lane. */
+	char exact[SELL_C];         /**< Flags of the lanes with an exact integral row. */
+	const int* ind;             /**< Row indices of the current nonzeros of the lanes. */
+	const double* val;          /**< Coefficients of the current nonzeros of the lanes. */
+	double new_delta_up;        /**< Up-shift of the current column. */
+	double new_delta_down;      /**< Down-shift of the current column. */
+	int j;                      /**< Column of the current lane. */
+
+	for (int lane = 0; lane < SELL_C; lane++) {
+		delta_up1[lane] = LONG_MAX;
+		delta_down1[lane] = LONG_MAX;
+		exact[lane] = 0;
+	}
+
+	// Ratio test of the SELL_C columns in lockstep, one nonzero of each per step (branch free lanes)
+	for (int k = 0; k < sell->len[c]; k++) {
+
+		ind = &(sell->ind[sell->beg[c] + (nzind_t)k * SELL_C]);
+		val = &(sell->val[sell->beg[c] + (nzind_t)k * SELL_C]);
+
+		for (int lane = 0; lane < SELL_C; lane++) {
+			double room_up = (val[lane] > 0.0) ? sell->room_up[ind[lane]] : sell->room_down[ind[lane]];
+			double room_down = (val[lane] > 0.0) ? sell->room_down[ind[lane]] : sell->room_up[ind[lane]];
+			delta_up1[lane] = min(room_up / fabs(val[lane]), delta_up1[lane]);
+			delta_down1[lane] = min(room_down / fabs(val[lane]), delta_down1[lane]);
+			exact[lane] |= sell->exact[ind[lane]];
+		}
+	}
+
+	// Bounds and integral shifts of each column (as in delta_updown and integral_deltas)
+	for (int lane = 0; lane < SELL_C; lane++) {
+
+		j = sell->col[c * SELL_C + lane];
+		if ((j < 0) || !oneopt_candidate(inst, j)) continue;
+		if (exact[lane]) { integral_deltas(inst, j, delta_up, delta_down); continue; }
+
+		new_delta_up = min(delta_up1[lane], inst->ub[j] - inst->x[j]);
+		new_delta_down = min(delta_down1[lane], inst->x[j] - inst->lb[j]);
+		if (less_than(new_delta_up, 1.0) && less_than(new_delta_down, 1.0)) {
+			new_delta_up = 0.0;
+			new_delta_down = 0.0;
+		}
+		delta_up[j] = new_delta_up;
+		delta_down[j] = new_delta_down;
+		integral_shifts(inst, j, delta_up, delta_down);
+	}
+}
+
+void sell_free(SELL* sell) {
+
+	free_all(8, sell->col, sell->len, sell->beg, sell->ind, sell->val, sell->room_up, sell->room_down, sell->exact);
+	sell->col = NULL; sell->len = NULL; sell->beg = NULL; sell->ind = NULL; sell->val = NULL;
+	sell->room_up = NULL; sell->room_down = NULL; sell->exact = NULL;
+	sell->num_chunks = 0;
+}
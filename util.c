@@ -16,9 +16,9 @@ void check_bounds(double* x, double* lb, double* ub, int ncols) {
 	}
 }
 
-void check_constraints(double* x, int ncols, int nrows, int nzcnt, int* rmatbeg, int* rmatind, double* rmatval, char* sense, double* rhs) {
+void check_constraints(double* x, int ncols, int nrows, nzind_t* rmatbeg, int* rmatind, double* rmatval, char* sense, double* rhs, int* row_orig) {
 
-	int rowend;    /**< Last variable index of the current row. */
+	nzind_t rowend; /**< Last variable index of the current row. */
 	double rowact; /**< Current row activity. */
 	int varind;    /**< Current variable index. */
 	int violated;  /**< Violated constraints flag. */
@@ -28,11 +28,11 @@ void check_constraints(double* x, int ncols, int nrows, int nzcnt, int* rmatbeg,
 	// Scan constraints
 	for (int i = 0; i < nrows; i++) {
 
-		rowend = (i < nrows - 1) ? rmatbeg[i + 1] : nzcnt;
+		rowend = rmatbeg[i + 1];
 		rowact = 0.0;
 
 		// Scan non-zero coefficients of the constraint and compute row activity
-		for (int k = rmatbeg[i]; k < rowend; k++) {
+		for (nzind_t k = rmatbeg[i]; k < rowend; k++) {
 
 			varind = rmatind[k];
 			assert(index_in_bounds(varind, ncols));
@@ -40,28 +40,7 @@ void check_constraints(double* x, int ncols, int nrows, int nzcnt, int* rmatbeg,
 		}
 
 		// Check compliance with the constraint sense
-		switch (sense[i]) {
-			case 'L':
-				if (rowact > rhs[i] + fabs(rhs[i]) / 1000 + TOLERANCE*1000) {
-					printf("___ L! %d ___ %f > %f", i, rowact, rhs[i]);
-					violated = 1;
-				}
-				break;
-			case 'G':
-				if (rowact < rhs[i] - fabs(rhs[i]) / 1000 - TOLERANCE*1000) {
-					printf("___ G! ___ %f < %f", rowact, rhs[i]);
-					violated = 1;
-				}
-				break;
-			case 'E':
-				if (fabs(rowact - rhs[i]) > fabs(rhs[i]) / 1000 + TOLERANCE*1000) {
-					printf("___ E! ___ %f != %f", rowact, rhs[i]);
-					violated = 1;
-				}
-				break;
-			default:
-				print_error("[check_constraints]: Constraint sense '%c' not supported.\n", sense[i]);
-		}
+		violated = row_violated((row_orig != NULL) ? row_orig[i] : i, rowact, sense[i], rhs[i]);
 
 		// Terminate program at the first violated constraint
 		if (violated) print_error("[check_constraints]: Some constraints are violated!\n");
@@ -70,6 +49,75 @@ void check_constraints(double* x, int ncols, int nrows, int nzcnt, int* rmatbeg,
 	print_verbose(100, "[check_constraints][OK]: Constraints satisfied.\n");
 }
 
+// [EXTENSION]
+void check_constraints_csc(INSTANCE* inst) {
+
+	COL_ITER col;   /**< Iterator over the constraints containing the current variable. */
+	int rowind;     /**< Current row index. */
+	double aij;     /**< Current constraint coefficient. */
+	double* rowact; /**< Row activities. */
+
+	// Allocate
+	rowact = (double*)calloc(max(inst->nrows, 1), sizeof(double)); if (rowact == NULL) print_error("[check_constraints_csc]: Failed to allocate row activities.\n");
+
+	// Scan variables and accumulate the row activities (column-wise, no row view needed)
+	for (int j = 0; j < inst->ncols; j++) {
+
+		if (inst->x[j] == 0.0) continue;
+		for (col_begin(inst, j, &col); col_next(&col, &rowind, &aij); ) {
+			assert(index_in_bounds(rowind, inst->nrows));
+			rowact[rowind] += (aij * inst->x[j]);
+		}
+	}
+
+	// Check compliance with the constraint senses, terminate program at the first violated constraint
+	for (int i = 0; i < inst->nrows; i++) {
+		if (row_violated(orig_row(inst, i), rowact[i], inst->sense[i], inst->rhs[i])) print_error("[check_constraints]: Some constraints are violated!\n");
+	}
+
+	// Free
+	free(rowact);
+
+	print_verbose(100, "[check_constraints][OK]: Constraints satisfied.\n");
+}
+
+// [EXTENSION]
+int row_violated(int i, double rowact, char sense, double rhs) {
+
+	switch (sense) {
+		case 'L':
+			if (rowact > rhs + fabs(rhs) / 1000 + TOLERANCE*1000) {
+				printf("___ L! %d ___ %f > %f", i, rowact, rhs);
+				return (1);
+			}
+			break;
+		case 'G':
+			if (rowact < rhs - fabs(rhs) / 1000 - TOLERANCE*1000) {
+				printf("___ G! ___ %f < %f", rowact, rhs);
+				return (1);
+			}
+			break;
+		case 'E':
+			if (fabs(rowact - rhs) > fabs(rhs) / 1000 + TOLERANCE*1000) {
+				printf("___ E! ___ %f != %f", rowact, rhs);
+				return (1);
+			}
+			break;
+		default:
+			print_error("[check_constraints]: Constraint sense '%c' not supported.\n", sense);
+	}
+
+	return (0);
+}
+
+// [EXTENSION]
+void check_inst_constraints(INSTANCE* inst) {
+
+	// Use the row view if available, the column view otherwise (CSC-only mode)
+	if (inst->rmatbeg != NULL) check_constraints(inst->x, inst->ncols, inst->nrows, inst->rmatbeg, inst->rmatind, inst->rmatval, inst->sense, inst->rhs, inst->row_orig);
+	else check_constraints_csc(inst);
+}
+
 int check_rounding(double* x, int ncols, int* int_var, char* vartype) {
 
 	// Scan integer/binary variables
@@ -131,6 +179,17 @@ double dot_product(double* coef, double* var_value, int len) {
 	return dotprod;
 }
 
+// [EXTENSION]
+void neumaier_add(double* sum, double* comp, double value) {
+
+	double t = *sum + value; /**< New running sum. */
+
+	// Low-order part lost by the addition (of the smaller operand)
+	if (fabs(*sum) >= fabs(value)) *comp += (*sum - t) + value;
+	else *comp += (value - t) + *sum;
+	*sum = t;
+}
+
 void free_all(int count, ...) {
 	va_list args;
 	va_start(args, count);
@@ -144,6 +203,131 @@ void free_all(int count, ...) {
 	fflush(NULL);
 }
 
+void heap_init(HEAP* heap, int len) {
+
+	heap->size = 0;
+	heap->len = max(len, 1);
+	heap->col = (int*)malloc(heap->len * sizeof(int));
+	heap->key = (double*)malloc(heap->len * sizeof(double));
+	heap->stamp = (int*)malloc(heap->len * sizeof(int)); if (heap->col == NULL || heap->key == NULL || heap->stamp == NULL) print_error("[heap_init]: Failed to allocate heap.\n");
+}
+
+void heap_push(HEAP* heap, int col, double key, int stamp) {
+
+	int pos;    /**< Current position of the new entry. */
+	int parent; /**< Position of the parent of the new entry. */
+
+	// Resize the arrays if necessary
+	if (heap->size == heap->len) {
+		heap->len *= 2;
+		heap->col = (int*)realloc(heap->col, heap->len * sizeof(int));
+		heap->key = (double*)realloc(heap->key, heap->len * sizeof(double));
+		heap->stamp = (int*)realloc(heap->stamp, heap->len * sizeof(int)); if (heap->col == NULL || heap->key == NULL || heap->stamp == NULL) print_error("[heap_push]: Failed to resize heap.\n");
+	}
+
+	// Sift up the new entry
+	pos = heap->size++;
+	while (pos > 0) {
+		parent = (pos - 1) / 2;
+		if (heap->key[parent] >= key) break;
+		heap->col[pos] = heap->col[parent]; heap->key[pos] = heap->key[parent]; heap->stamp[pos] = heap->stamp[parent];
+		pos = parent;
+	}
+	heap->col[pos] = col; heap->key[pos] = key; heap->stamp[pos] = stamp;
+}
+
+void heap_pop(HEAP* heap, int* col, double* key, int* stamp) {
+
+	int pos;         /**< Current position of the last entry. */
+	int child;       /**< Position of the greater child. */
+	int last_col;    /**< Column index of the last entry. */
+	double last_key; /**< Key of the last entry. */
+	int last_stamp;  /**< Stamp of the last entry. */
+
+	assert(positive_integer(heap->size));
+	*col = heap->col[0]; *key = heap->key[0]; *stamp = heap->stamp[0];
+
+	// Sift down the last entry from the top
+	heap->size--;
+	last_col = heap->col[heap->size]; last_key = heap->key[heap->size]; last_stamp = heap->stamp[heap->size];
+	pos = 0;
+	while ((child = 2 * pos + 1) < heap->size) {
+		if ((child + 1 < heap->size) && (heap->key[child + 1] > heap->key[child])) child++;
+		if (last_key >= heap->key[child]) break;
+		heap->col[pos] = heap->col[child]; heap->key[pos] = heap->key[child]; heap->stamp[pos] = heap->stamp[child];
+		pos = child;
+	}
+	heap->col[pos] = last_col; heap->key[pos] = last_key; heap->stamp[pos] = last_stamp;
+}
+
+void heap_free(HEAP* heap) {
+
+	free_all(3, heap->col, heap->key, heap->stamp);
+	heap->col = NULL; heap->key = NULL; heap->stamp = NULL;
+	heap->size = 0; heap->len = 0;
+}
+
+void random_permutation(int* perm, int n, unsigned int seed) {
+
+	unsigned int state; /**< State of the xorshift generator. */
+	int k;              /**< Random index. */
+	int temp;           /**< Support variable for the swaps. */
+
+	state = seed * 2654435761u + 0x9E3779B9u;
+	if (state == 0) state = 1;
+
+	for (int i = 0; i < n; i++) perm[i] = i;
+	for (int i = n - 1; i > 0; i--) {
+		state ^= state << 13; state ^= state >> 17; state ^= state << 5;
+		k = (int)(state % (unsigned int)(i + 1));
+		temp = perm[i]; perm[i] = perm[k]; perm[k] = temp;
+	}
+}
+
+void sset_init(SPARSE_SET* set, int ncols) {
+
+	set->size = 0;
+	set->dense = (int*)malloc(max(ncols, 1) * sizeof(int));
+	set->pos = (int*)malloc(max(ncols, 1) * sizeof(int)); if (set->dense == NULL || set->pos == NULL) print_error("[sset_init]: Failed to allocate sparse set.\n");
+	for (int j = 0; j < ncols; j++) set->pos[j] = -1;
+}
+
+void sset_insert(SPARSE_SET* set, int col) {
+
+	if (set->pos[col] >= 0) return;
+	set->pos[col] = set->size;
+	set->dense[set->size++] = col;
+}
+
+void sset_remove(SPARSE_SET* set, int col) {
+
+	int last; /**< Column in the last position (moved into the position of the removed one). */
+
+	if (set->pos[col] < 0) return;
+	last = set->dense[--(set->size)];
+	set->dense[set->pos[col]] = last;
+	set->pos[last] = set->pos[col];
+	set->pos[col] = -1;
+}
+
+void sset_free(SPARSE_SET* set) {
+
+	free_all(2, set->dense, set->pos);
+	set->dense = NULL; set->pos = NULL;
+	set->size = 0;
+}
+
+int compare_int(const void* a, const void* b) {
+
+	return (*(const int*)a > *(const int*)b) - (*(const int*)a < *(const int*)b);
+}
+
+// [EXTENSION]
+int compare_double(const void* a, const void* b) {
+
+	return (*(const double*)a > *(const double*)b) - (*(const double*)a < *(const double*)b);
+}
+
 void create_instances_list(const char* folder_path, const char* output_file) {
 
 	FILE* output; /**< Pointer to the instances list. */
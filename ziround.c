@@ -20,10 +20,30 @@ void zi_round(INSTANCE* inst, int* numrounds) {
 	int toround[2];      /**< Circular buffer for current number of variables to round. */
 	int round_number[2]; /**< Circular buffer for current round number. */
 	int bufind;          /**< Current index in the circular buffer. */
-
-	// Allocate / Initialize
-	delta_up   = (double*)malloc(inst->ncols * sizeof(double));
-	delta_down = (double*)malloc(inst->ncols * sizeof(double)); if (delta_up == NULL || delta_down == NULL) print_error("[zi_round]: Failed to allocate delta arrays.\n");
+	int shift_nonfrac;   /**< Local copy of the flag for shifting non-fractional variables (turned off by the stall switch). */
+	double frac_start;   /**< Solution fractionality at the beginning of the current round. */
+	double obj_start;    /**< Objective value at the beginning of the current round. */
+	int toround_start;   /**< Number of variables to round at the beginning of the current round. */
+	double obj_gain;     /**< Relative objective improvement of the current round. */
+	int num_stalled;     /**< Current number of consecutive stalled rounds. */
+	int stop;            /**< Flag set to 1 when the stall rule stops the outer loop. */
+	double epsilon;      /**< Threshold of the fractional shifts in the current round. */
+	double prev_epsilon; /**< Threshold of the fractional shifts in the previous round. */
+	int* order;          /**< Column visit order of the current round (NULL = index order, see also the permutation of the instance). */
+	int* pushed;         /**< Flags of the columns already placed in the visit order. */
+	HEAP heap;           /**< Fractional columns in decreasing order of priority. */
+	SPARSE_SET fracset;  /**< Positions in movable of the columns that are currently fractional. */
+	int* snapshot;       /**< Positions in movable of the fractional columns at the beginning of the current round (in index order). */
+	int fractional_only; /**< Flag set to 1 when the current round can only shift fractional columns. */
+	int num_visit;       /**< Number of columns visited in the current round. */
+
+	// Allocate / Initialize (the parts of the component rounding share the delta arrays of their instance)
+	delta_up = inst->part_delta_up;
+	delta_down = inst->part_delta_down;
+	if (!(inst->is_part)) {
+		delta_up   = (double*)malloc(inst->ncols * sizeof(double));
+		delta_down = (double*)malloc(inst->ncols * sizeof(double)); if (delta_up == NULL || delta_down == NULL) print_error("[zi_round]: Failed to allocate delta arrays.\n");
+	}
 	ZI = 0.0; ZIplus = 0.0; ZIminus = 0.0;
 	updated = 0; 
 	num_toround = 0; *numrounds = 0;
@@ -32,6 +52,26 @@ void zi_round(INSTANCE* inst, int* numrounds) {
 	toround[0] = 0; toround[1] = 0;
 	round_number[0] = 1; round_number[1] = 1;
 	bufind = 0;
+	shift_nonfrac = inst->shift_nonfracvars && !(inst->one_opt); // [EXTENSION] the 1-opt phase replaces the shifts of non-fractional variables
+	frac_start = 0.0; obj_start = 0.0; toround_start = 0; obj_gain = 0.0;
+	num_stalled = 0; stop = 0;
+	epsilon = max(EPSILON, inst->eps_start); prev_epsilon = epsilon;
+	inst->stall_round = 0; inst->stall_saved = 0;
+	inst->zerofrac_round = 0;
+	order = inst->perm; pushed = NULL;
+	if (inst->col_order > 0) {
+		order  = (int*)malloc(inst->ncols * sizeof(int));
+		pushed = (int*)malloc(inst->ncols * sizeof(int)); if (order == NULL || pushed == NULL) print_error("[zi_round]: Failed to allocate column order arrays.\n");
+		heap_init(&heap, inst->ncols);
+	}
+	sset_init(&fracset, inst->num_movable);
+	snapshot = (int*)malloc(max(inst->num_movable, 1) * sizeof(int)); if (snapshot == NULL) print_error("[zi_round]: Failed to allocate fractional columns snapshot.\n");
+	for (int k = 0; k < inst->num_movable; k++) if (is_fractional(inst->x[inst->movable[k]])) sset_insert(&fracset, k);
+	if (!(inst->is_part)) { // [EXTENSION] Done once for all the parts by component_round
+		load_singletons(inst); // [EXTENSION] Singletons are moved in their packed records during the rounding
+		load_integral_rows(inst); // [EXTENSION] Exact slacks of the integral rows (if enabled)
+	}
+	inst->objval_comp = 0.0; inst->solfrac_comp = 0.0; // [EXTENSION] Compensated incremental objective and fractionality
 	
 	// Allocate / Initialize plotting variables
 	inst->size_frac = 0; inst->size_cost = 0; inst->size_toround = 0;
@@ -44,10 +84,13 @@ void zi_round(INSTANCE* inst, int* numrounds) {
 
 	// Print solution fractionality, cost, number of variables to round and update trackers
 	print_verbose(10, "*******************************\n* Solfrac | Objval | #ToRound | Round *\n");
-	inst->solfrac = sol_fractionality(inst->x, inst->int_var, inst->ncols);
+	if (inst->is_part) part_fractionality(inst, &num_toround); // [EXTENSION] Only the columns of the part
+	else {
+		inst->solfrac = sol_fractionality(inst->x, inst->int_var, inst->ncols);
+		num_toround = inst->num_int_vars - count_rounded(inst->x, inst->ncols, inst->int_var, inst->vartype); // Initialize (brute force) only once
+	}
 	frac[bufind] = inst->solfrac;
 	objval[bufind] = inst->objval;
-	num_toround = inst->num_int_vars - count_rounded(inst->x, inst->ncols, inst->int_var, inst->vartype); // Initialize (brute force) only once
 	toround[bufind] = num_toround;
 	print_verbose(10, "* %.3f | %.3f | %d | %d *\n", frac[bufind], objval[bufind], toround[bufind], *numrounds + 1);
 	if (VERBOSE >= 10) {
@@ -61,9 +104,27 @@ void zi_round(INSTANCE* inst, int* numrounds) {
 	do {
 		updated = 0;
 		(*numrounds)++;
+		frac_start = inst->solfrac;
+		obj_start = inst->objval;
+		toround_start = num_toround;
+
+		// [EXTENSION] Visit the fractional columns by priority first (keys computed on the slacks at the beginning of the round)
+		if (inst->col_order > 0) priority_order(inst, order, pushed, &heap, delta_up, delta_down, epsilon);
+
+		// [EXTENSION] When only fractional columns can move (and no order is imposed), visit just the fractional set (in index order)
+		fractional_only = (order == NULL) && (!shift_nonfrac || (inst->after0frac && !zero(inst->solfrac)));
+		if (fractional_only) {
+			memcpy(snapshot, fracset.dense, fracset.size * sizeof(int));
+			qsort(snapshot, fracset.size, sizeof(int), compare_int);
+			print_verbose(20, "[zi_round]: ... Fractional columns only: %d out of %d movable ...\n", fracset.size, inst->num_movable);
+		}
+		num_visit = (order != NULL) ? inst->ncols : (fractional_only) ? fracset.size : inst->num_movable;
 
-		// Inner loop (for each variable xj that was integer/binary in the original MIP)
-		for (int j = 0; j < inst->ncols; j++) {
+		// Inner loop (for each movable variable xj that was integer/binary in the original MIP, all variables if ordered)
+		for (int k = 0; k < num_visit; k++) {
+
+			int p = (order != NULL) ? -1 : (fractional_only) ? snapshot[k] : k; // [EXTENSION] Position of xj in movable (-1 in a column order)
+			int j = (p >= 0) ? inst->movable[p] : order[k];
 
 			// Skip non-integer variables and FIXED variables
 			if (!(inst->int_var[j]) || equals(inst->lb[j], inst->ub[j])) continue;
@@ -74,36 +135,27 @@ void zi_round(INSTANCE* inst, int* numrounds) {
 				// xj non fractional
 				case 0:
 
-					// Skip xj if shifting of non-fractional integer variables is disabled
-					if (!(inst->shift_nonfracvars)) continue;
+					// Skip xj if shifting of non-fractional integer variables is disabled (or switched off by the stall rule)
+					if (!shift_nonfrac) continue;
 					// Skip xj if want to wait until zero fractionality
 					if (inst->after0frac && !zero(inst->solfrac)) continue;
 
-					// Calculate deltas (with epsilon = 1.0)
-					delta_updown(inst, j, delta_up, delta_down, 1.0);
-					assert(
-						var_in_bounds(inst->x[j] + delta_up[j], inst->lb[j], inst->ub[j]) & 
-						var_in_bounds(inst->x[j] - delta_down[j], inst->lb[j], inst->ub[j])
-					);
+					// Calculate integral deltas (with epsilon = 1.0)
+					integral_deltas(inst, j, delta_up, delta_down);
 
 					// Skip xj if both deltas are equal to zero (no shift necessary)
 					if (zero(delta_up[j]) && zero(delta_down[j])) continue;
 
-					// Condition(s) for rounding of xj (>= to include the case of a zero obj coefficient)
-					if ((inst->obj[j] >= 0 && equals(delta_down[j], 1.0)) ||
-						(inst->obj[j] <= 0 && equals(delta_up[j], 1.0))) {
-
-						// Round xj to improve objective and update slacks
-						updated = updated | round_xj_bestobj(inst, j, inst->obj[j], delta_up[j], delta_down[j], 0, &(inst->solfrac), &num_toround); // flag xj non-fractional (0)
-					}
+					// Round xj to improve objective and update slacks (round_xj_bestobj only shifts in the improving direction)
+					updated = updated | round_xj_bestobj(inst, j, inst->obj[j], delta_up[j], delta_down[j], 0, &(inst->solfrac), &num_toround); // flag xj non-fractional (0)
 
 					break;
 
 				// xj fractional
 				case 1:
 
-					// Calculate deltas
-					delta_updown(inst, j, delta_up, delta_down, EPSILON);
+					// Calculate deltas (with the threshold of the current round)
+					delta_updown(inst, j, delta_up, delta_down, epsilon);
 					assert(
 						var_in_bounds(inst->x[j] + delta_up[j], inst->lb[j], inst->ub[j]) & 
 						var_in_bounds(inst->x[j] - delta_down[j], inst->lb[j], inst->ub[j])
@@ -137,17 +189,17 @@ void zi_round(INSTANCE* inst, int* numrounds) {
 						// Check whether all affected constraints have enough slack for a ROUND UP of xj
 						check_slacks(inst, j, delta_up[j], delta_down[j], 'U');
 
-						inst->solfrac -= fractionality(inst->x[j]); // (1) Assume xj fractional will be rounded to an integer
+						neumaier_add(&(inst->solfrac), &(inst->solfrac_comp), -fractionality(inst->x[j])); // (1) Assume xj fractional will be rounded to an integer
 						
 						// Round UP
 						inst->x[j] += delta_up[j];
 
-						inst->solfrac += fractionality(inst->x[j]); // (2) In case xj was not rounded
+						neumaier_add(&(inst->solfrac), &(inst->solfrac_comp), fractionality(inst->x[j])); // (2) In case xj was not rounded
 
 						updated = 1;
 						if (!is_fractional(inst->x[j])) num_toround--;
 						update_slacks(inst, j, delta_up[j]);
-						inst->objval += (inst->obj[j] * delta_up[j]);
+						neumaier_add(&(inst->objval), &(inst->objval_comp), inst->obj[j] * delta_up[j]);
 					}
 
 					// Third case: ZIminus < ZIplus && ZIminus < ZI --> Round DOWN
@@ -161,17 +213,17 @@ void zi_round(INSTANCE* inst, int* numrounds) {
 						// Check whether all affected constraints have enough slack for a ROUND DOWN of xj
 						check_slacks(inst, j, delta_up[j], delta_down[j], 'D');
 
-						inst->solfrac -= fractionality(inst->x[j]); // (1) Assume xj fractional will be rounded to an integer
+						neumaier_add(&(inst->solfrac), &(inst->solfrac_comp), -fractionality(inst->x[j])); // (1) Assume xj fractional will be rounded to an integer
 						
 						// Round DOWN
 						inst->x[j] -= delta_down[j];
 
-						inst->solfrac += fractionality(inst->x[j]); // (2) In case xj was not rounded
+						neumaier_add(&(inst->solfrac), &(inst->solfrac_comp), fractionality(inst->x[j])); // (2) In case xj was not rounded
 
 						updated = 1;
 						if (!is_fractional(inst->x[j])) num_toround--;
 						update_slacks(inst, j, -(delta_down[j]));
-						inst->objval -= (inst->obj[j] * delta_down[j]);
+						neumaier_add(&(inst->objval), &(inst->objval_comp), -(inst->obj[j] * delta_down[j]));
 					}
 
 					break;
@@ -180,6 +232,19 @@ void zi_round(INSTANCE* inst, int* numrounds) {
 					print_error(" in function is_fractional.\n");
 			}
 
+			// [EXTENSION] Keep the fractional set up to date (xj may have changed integrality, the set is not used in a column order)
+			if (p >= 0) {
+				if (is_fractional(inst->x[j])) sset_insert(&fracset, p);
+				else sset_remove(&fracset, p);
+			}
+
+			// [EXTENSION] Fractionality reached zero in a fractional-only round: go on with the movable columns after xj, as a full scan would
+			if (fractional_only && shift_nonfrac && zero(inst->solfrac)) {
+				fractional_only = 0;
+				num_visit = inst->num_movable;
+				k = p;
+			}
+
 			// Print solution fractionality, cost, number of variables to round and update trackers
 			frac[bufind] = inst->solfrac;
 			objval[bufind] = inst->objval;
@@ -200,30 +265,106 @@ void zi_round(INSTANCE* inst, int* numrounds) {
 			bufind = !bufind;
 		} // end inner loop
 
+		if ((inst->zerofrac_round == 0) && zero(inst->solfrac)) inst->zerofrac_round = *numrounds;
+
 		if (updated) print_verbose(20, "[zi_round]: ... Some roundings occured, scan variables again ...\n");
 		else print_verbose(20, "[zi_round]: ... No roundings, exit outer loop ...\n");
 		
 		// [DEBUG ONLY] (BRUTE FORCE)  Check variable bounds and constraints
 		if (VERBOSE >= 201) {
 			check_bounds(inst->x, inst->lb, inst->ub, inst->ncols);
-			check_constraints(inst->x, inst->ncols, inst->nrows, inst->nzcnt, inst->rmatbeg, inst->rmatind, inst->rmatval, inst->sense, inst->rhs);
+			check_inst_constraints(inst);
+		}
+
+		// [EXTENSION] Periodic recomputation of the incremental state from scratch
+		if ((inst->resync_rounds > 0) && (*numrounds % inst->resync_rounds == 0) && !(inst->is_part)) resync_state(inst);
+
+		// [EXTENSION] Stall detection: count consecutive rounds that improve fractionality and objective by less than the thresholds
+		if ((inst->stall_rounds > 0) && updated) {
+
+			obj_gain = (inst->objsen == CPX_MIN) ? (obj_start - inst->objval) : (inst->objval - obj_start);
+			obj_gain /= max(1.0, fabs(obj_start));
+
+			if ((frac_start - inst->solfrac < inst->stall_frac) && (obj_gain < inst->stall_obj) && (num_toround >= toround_start)) num_stalled++;
+			else num_stalled = 0;
+
+			if (num_stalled == inst->stall_rounds) {
+
+				print_verbose(20, "[zi_round]: ... Stalled for %d rounds (round %d) ...\n", num_stalled, *numrounds);
+				if (inst->stall_round == 0) inst->stall_round = *numrounds;
+				num_stalled = 0;
+
+				switch (inst->stall_action) {
+					case 0: // Monitor only
+						break;
+					case 1: // Stop
+						stop = 1;
+						break;
+					case 2: // Switch to fractional shifts only, stop if already switched
+						if (shift_nonfrac) shift_nonfrac = 0;
+						else stop = 1;
+						break;
+					default:
+						print_error("[zi_round]: Stall action %d not supported.\n", inst->stall_action);
+				}
+			}
 		}
 
+		// [EXTENSION] Tighten the threshold of the fractional shifts (straight to EPSILON if nothing moved)
+		prev_epsilon = epsilon;
+		epsilon = (updated) ? max(EPSILON, epsilon * inst->eps_decay) : EPSILON;
+		if (prev_epsilon > EPSILON) print_verbose(20, "[zi_round]: ... Fractional shifts threshold %e -> %e ...\n", prev_epsilon, epsilon);
+
 		// Exit outer loop if reached max rounds (>0 activated)
 		if ((inst->max_rounds > 0) && (*numrounds == inst->max_rounds)) break;
 
-	} while (updated); // end outer loop
+	} while ((updated || prev_epsilon > EPSILON) && !stop); // end outer loop (a round without updates only ends it at the final threshold)
+
+	// Rounds that the stall rule would have saved (monitor mode only)
+	if ((inst->stall_action == 0) && (inst->stall_round > 0)) inst->stall_saved = *numrounds - inst->stall_round;
+
+	// [EXTENSION] Parts of the component rounding: the rest is done once on the whole instance by component_round
+	if (inst->is_part) {
+		inst->objval += inst->objval_comp; inst->objval_comp = 0.0;
+		inst->solfrac += inst->solfrac_comp; inst->solfrac_comp = 0.0;
+	}
+	else end_rounding(inst, num_toround);
 
 	// Free
-	free(delta_up);
-	free(delta_down);
+	if (!(inst->is_part)) free_all(2, delta_up, delta_down);
+	if (inst->col_order > 0) {
+		free_all(2, order, pushed);
+		heap_free(&heap);
+	}
+	sset_free(&fracset);
+	free(snapshot);
+}
+
+// [EXTENSION]
+void end_rounding(INSTANCE* inst, int num_toround) {
+
+	// [EXTENSION] Shift non-fractional integer variables in a separate 1-opt phase
+	if (inst->one_opt && inst->shift_nonfracvars) {
+		one_opt(inst);
+		print_verbose(10, "* %.3f | %.3f | %d | 1-opt *\n", inst->solfrac, inst->objval, num_toround);
+	}
+
+	// [EXTENSION] Lazy singletons: distribute the aggregated singletons slacks among the singletons (also updates the objective)
+	if (inst->lazy_singletons) {
+		materialize_singletons(inst);
+		print_verbose(10, "* %.3f | %.3f | %d | singletons *\n", inst->solfrac, inst->objval, num_toround);
+	}
+	store_singletons(inst);
+	free_integral_rows(inst);
+	inst->objval += inst->objval_comp; inst->objval_comp = 0.0;
+	inst->solfrac += inst->solfrac_comp; inst->solfrac_comp = 0.0;
 }
 
 void check_slacks(INSTANCE* inst, int j, double delta_up, double delta_down, const char round_updown) {
 
 	if (round_updown != 'U' && round_updown != 'D') print_error("[check_slacks]: Rounding sense '%c' undefined.\n", round_updown);
 
-	int colend;              /**< Index of the last constraint containing variable \p j. */
+	COL_ITER col;            /**< Iterator over the constraints containing variable \p j. */
 	int rowind;              /**< Current row index. */
 	double aij;              /**< Current constraint coefficient of variable \p j. */
 	double curr_slack;       /**< Slack of the current constraint. */
@@ -235,41 +376,39 @@ void check_slacks(INSTANCE* inst, int j, double delta_up, double delta_down, con
 	double ss_ub;            /**< Upper bound of current singletons slack (in its row). */
 	double delta_ss;         /**< Delta singletons slack after rounding. */
 	double new_ss;           /**< Singletons slack after rounding. */
-
-	colend = (j < inst->ncols - 1) ? inst->cmatbeg[j + 1] : inst->nzcnt;
+	ROW_STATE* row;          /**< Hot state of the current row. */
 
 	// Check whether all affected constraints have enough slack for a ROUND UP/DOWN of xj
-	for (int k = inst->cmatbeg[j]; k < colend; k++) {
+	for (col_begin(inst, j, &col); col_next(&col, &rowind, &aij); ) {
 
-		rowind = inst->cmatind[k];
 		assert(index_in_bounds(rowind, inst->nrows));
-		aij = inst->cmatval[k];
+		row = &(inst->rows[rowind]);
 		curr_slack = 0.0;
 		singletons_slack = 0.0;
 		delta_slack = 0.0;
 		new_slack = 0.0;
 		enough_slack = 0;
 
-		switch (inst->sense[rowind]) {
+		switch (row->sense) {
 
 			case 'L': // (slack non-negative)
 			case 'G': // (slack non-positive)
 
-				curr_slack = inst->slack[rowind];
-				(inst->sense[rowind] == 'L') ? assert(non_negative(curr_slack)) : assert(non_positive(curr_slack));
+				curr_slack = row->slack;
+				(row->sense == 'L') ? assert(non_negative(curr_slack)) : assert(non_positive(curr_slack));
 				delta_slack = (round_updown == 'U') ? (aij * delta_up) : (aij * (-delta_down));
 
 				// Row slack after rounding (negative for 'L', positive for 'G' constraints iff also singletons slack should be used)
 				new_slack = curr_slack - delta_slack;
-				print_verbose(200, "[check_slacks][x_%d aij %f][row %d '%c']: new_slack = %f\n", j + 1, aij, rowind + 1, inst->sense[rowind], new_slack);
+				print_verbose(200, "[check_slacks][x_%d aij %f][row %d '%c']: new_slack = %f\n", j + 1, aij, orig_row(inst, rowind) + 1, row->sense, new_slack);
 
 				// [EXTENSION] Distinguish inequality constraints with singletons (if singletons enabled)
-				if ((inst->singletons) && (inst->num_singletons[rowind] > 0)) {
+				if (row->has_ss) {
 
 					// If the new row slack is negative for 'L', positive for 'G' constraints, then the remaining amount must be covered by the singletons slack
-					if ((inst->sense[rowind] == 'L' && negative(new_slack)) || (inst->sense[rowind] == 'G' && positive(new_slack))) {
+					if ((row->sense == 'L' && negative(new_slack)) || (row->sense == 'G' && positive(new_slack))) {
 
-						(inst->sense[rowind] == 'L') ? assert(negative(new_slack)) : assert(positive(new_slack));
+						(row->sense == 'L') ? assert(negative(new_slack)) : assert(positive(new_slack));
 
 						// Compute singletons slack of constraint rowind and get bounds
 						ss_lb = inst->ss_lb[rowind];
@@ -292,17 +431,17 @@ void check_slacks(INSTANCE* inst, int j, double delta_up, double delta_down, con
 				}
 				else {
 					// Extension disabled OR enabled but no singletons
-					enough_slack = (inst->sense[rowind] == 'L') ? non_negative(new_slack) : non_positive(new_slack);
+					enough_slack = (row->sense == 'L') ? non_negative(new_slack) : non_positive(new_slack);
 				}
 
-				if (!enough_slack) print_error("[check_slacks][x_%d][row %d '%c']: After rounding, invalid slack.\n", j + 1, rowind + 1, inst->sense[rowind]);
+				if (!enough_slack) print_error("[check_slacks][x_%d][row %d '%c']: After rounding, invalid slack.\n", j + 1, orig_row(inst, rowind) + 1, row->sense);
 
 				break;
 			
 			case 'E': // (slack zero if singletons disabled)
 
 				// [EXTENSION] Distinguish equality constraints with singletons (if singletons enabled)
-				if (inst->singletons && inst->num_singletons[rowind] > 0) {
+				if (row->has_ss) {
 
 					// Compute singletons slack of constraint rowind (with bounds)
 					ss_lb = inst->ss_lb[rowind];
@@ -318,17 +457,17 @@ void check_slacks(INSTANCE* inst, int j, double delta_up, double delta_down, con
 					// New singletons slack must stay within its bounds
 					enough_slack = var_in_bounds(new_ss, ss_lb, ss_ub);
 					
-					if (!enough_slack) print_error("[check_slacks][singletons][x_%d][row %d '%c']: After rounding, singletons slack out of bounds. Found %f <= %f <= %f.\n", j + 1, rowind + 1, inst->sense[rowind], ss_lb, new_ss, ss_ub);
+					if (!enough_slack) print_error("[check_slacks][singletons][x_%d][row %d '%c']: After rounding, singletons slack out of bounds. Found %f <= %f <= %f.\n", j + 1, orig_row(inst, rowind) + 1, row->sense, ss_lb, new_ss, ss_ub);
 				}
 				else {
 					// Extension disabled OR enabled but no singletons
-					print_error("[check_slacks][x_%d][row %d '%c']: Extension disabled OR constraint has no singletons --> slack ZERO --> x_%d cannot be rounded.\n", j + 1, rowind + 1, inst->sense[rowind], j + 1);
+					print_error("[check_slacks][x_%d][row %d '%c']: Extension disabled OR constraint has no singletons --> slack ZERO --> x_%d cannot be rounded.\n", j + 1, orig_row(inst, rowind) + 1, row->sense, j + 1);
 				}
 
 				break;
 
 			default:
-				print_error("[check_slacks]: Constraint sense '%c' not included in {'L','G','E'}.\n", inst->sense[rowind]);
+				print_error("[check_slacks]: Constraint sense '%c' not included in {'L','G','E'}.\n", row->sense);
 		} // end switch
 	} // end for
 }
@@ -360,8 +499,8 @@ int round_xj_bestobj(INSTANCE* inst, int j, double objcoef, double delta_up, dou
 
 				print_verbose(20, "[round_xj_bestobj]: >>> Round x_%d = %f + %f = %f\n", j + 1, inst->x[j], delta_up, inst->x[j] + delta_up);
 
-				// If xj is integer (not fractional) then delta_up[j] should be 1.0
-				assert(xj_fractional || equals(delta_up, 1.0));
+				// If xj is integer (not fractional) then delta_up[j] should be integral
+				assert(xj_fractional || !is_fractional(delta_up));
 
 				// Check whether all affected constraints have enough slack for a ROUND UP of xj
 				check_slacks(inst, j, delta_up, delta_down, 'U');
@@ -369,21 +508,21 @@ int round_xj_bestobj(INSTANCE* inst, int j, double objcoef, double delta_up, dou
 				// (1) Assume xj fractional will be rounded to an integer
 				if (xj_fractional) { 
 					(*num_toround)--; 
-					*solfrac -= fractionality(inst->x[j]); 
+					neumaier_add(solfrac, &(inst->solfrac_comp), -fractionality(inst->x[j]));
 				}
 
-				// Round UP (if xj is not fractional then delta_up[j] must be 1.0)
+				// Round UP (if xj is not fractional then delta_up[j] must be integral)
 				inst->x[j] += delta_up;
 
 				// (2) If xj was not rounded to an integer
 				if (is_fractional(inst->x[j])) {
 					(*num_toround)++;
-					*solfrac += fractionality(inst->x[j]);
+					neumaier_add(solfrac, &(inst->solfrac_comp), fractionality(inst->x[j]));
 				}
 
 				updated = 1;
 				update_slacks(inst, j, delta_up);
-				inst->objval += obj_deltaplus;
+				neumaier_add(&(inst->objval), &(inst->objval_comp), obj_deltaplus);
 			}
 			// [] Adding -delta_down to x_j improves objval more
 			else if (negative(obj_deltaminus) && less_than(obj_deltaminus, obj_deltaplus)) {
@@ -393,8 +532,8 @@ int round_xj_bestobj(INSTANCE* inst, int j, double objcoef, double delta_up, dou
 
 				print_verbose(20, "[round_xj_bestobj]: >>> Round x_%d = %f - %f = %f\n", j + 1, inst->x[j], delta_down, inst->x[j] - delta_down);
 				
-				// If xj is integer (not fractional) then delta_down[j] should be 1.0
-				assert(xj_fractional || equals(delta_down, 1.0));
+				// If xj is integer (not fractional) then delta_down[j] should be integral
+				assert(xj_fractional || !is_fractional(delta_down));
 
 				// Check whether all affected constraints have enough slack for a ROUND DOWN of xj
 				check_slacks(inst, j, delta_up, delta_down, 'D');
@@ -402,21 +541,21 @@ int round_xj_bestobj(INSTANCE* inst, int j, double objcoef, double delta_up, dou
 				// (1) Assume xj fractional will be rounded to an integer
 				if (xj_fractional) {
 					(*num_toround)--;
-					*solfrac -= fractionality(inst->x[j]);
+					neumaier_add(solfrac, &(inst->solfrac_comp), -fractionality(inst->x[j]));
 				}
 
-				// Round DOWN (if xj is not fractional then delta_down[j] must be 1.0)
+				// Round DOWN (if xj is not fractional then delta_down[j] must be integral)
 				inst->x[j] -= delta_down;
 
 				// (2) If xj was not rounded to an integer
 				if (is_fractional(inst->x[j])) {
 					(*num_toround)++;
-					*solfrac += fractionality(inst->x[j]);
+					neumaier_add(solfrac, &(inst->solfrac_comp), fractionality(inst->x[j]));
 				}
 
 				updated = 1;
 				update_slacks(inst, j, -(delta_down));
-				inst->objval += obj_deltaminus;
+				neumaier_add(&(inst->objval), &(inst->objval_comp), obj_deltaminus);
 			}
 			// [] Both deltas improve objval of the same amount < 0 --> Round arbitrarily (DOWN)
 			else if (equals(obj_deltaminus, obj_deltaplus) && negative(obj_deltaminus)) {
@@ -432,7 +571,7 @@ int round_xj_bestobj(INSTANCE* inst, int j, double objcoef, double delta_up, dou
 				// (1) Assume xj fractional will be rounded to an integer
 				if (xj_fractional) {
 					(*num_toround)--;
-					*solfrac -= fractionality(inst->x[j]);
+					neumaier_add(solfrac, &(inst->solfrac_comp), -fractionality(inst->x[j]));
 				}
 
 				// Round arbitrarily (DOWN)
@@ -441,12 +580,12 @@ int round_xj_bestobj(INSTANCE* inst, int j, double objcoef, double delta_up, dou
 				// (2) If xj was not rounded to an integer
 				if (is_fractional(inst->x[j])) {
 					(*num_toround)++;
-					*solfrac += fractionality(inst->x[j]);
+					neumaier_add(solfrac, &(inst->solfrac_comp), fractionality(inst->x[j]));
 				}
 
 				updated = 1;
 				update_slacks(inst, j, -(delta_down));
-				inst->objval += obj_deltaminus;
+				neumaier_add(&(inst->objval), &(inst->objval_comp), obj_deltaminus);
 			}
 			// [] Both deltas do not change objval (both = 0) --> Round arbitrarily (UP)
 			else if (zero(obj_deltaplus) && zero(obj_deltaminus)) {
@@ -464,7 +603,7 @@ int round_xj_bestobj(INSTANCE* inst, int j, double objcoef, double delta_up, dou
 				// (1) Assume xj fractional will be rounded to an integer
 				if (xj_fractional) {
 					(*num_toround)--;
-					*solfrac -= fractionality(inst->x[j]);
+					neumaier_add(solfrac, &(inst->solfrac_comp), -fractionality(inst->x[j]));
 				}
 
 				// Round arbitrarily (UP)
@@ -473,7 +612,7 @@ int round_xj_bestobj(INSTANCE* inst, int j, double objcoef, double delta_up, dou
 				// (2) If xj was not rounded to an integer
 				if (is_fractional(inst->x[j])) {
 					(*num_toround)++;
-					*solfrac += fractionality(inst->x[j]);
+					neumaier_add(solfrac, &(inst->solfrac_comp), fractionality(inst->x[j]));
 				}
 
 				updated = 1;
@@ -494,8 +633,8 @@ int round_xj_bestobj(INSTANCE* inst, int j, double objcoef, double delta_up, dou
 				
 				print_verbose(20, "[round_xj_bestobj]: >>> Round x_%d = %f + %f = %f\n", j + 1, inst->x[j], delta_up, inst->x[j] + delta_up);
 				
-				// If xj is integer (not fractional) then delta_up[j] should be 1.0
-				assert(xj_fractional || equals(delta_up, 1.0));
+				// If xj is integer (not fractional) then delta_up[j] should be integral
+				assert(xj_fractional || !is_fractional(delta_up));
 
 				// Check whether all affected constraints have enough slack for a ROUND UP of xj
 				check_slacks(inst, j, delta_up, delta_down, 'U');
@@ -503,21 +642,21 @@ int round_xj_bestobj(INSTANCE* inst, int j, double objcoef, double delta_up, dou
 				// (1) Assume xj fractional will be rounded to an integer
 				if (xj_fractional) {
 					(*num_toround)--;
-					*solfrac -= fractionality(inst->x[j]);
+					neumaier_add(solfrac, &(inst->solfrac_comp), -fractionality(inst->x[j]));
 				}
 
-				// Round UP (if xj is not fractional then delta_up[j] must be 1.0)
+				// Round UP (if xj is not fractional then delta_up[j] must be integral)
 				inst->x[j] += delta_up;
 
 				// (2) If xj was not rounded to an integer
 				if (is_fractional(inst->x[j])) {
 					(*num_toround)++;
-					*solfrac += fractionality(inst->x[j]);
+					neumaier_add(solfrac, &(inst->solfrac_comp), fractionality(inst->x[j]));
 				}
 
 				updated = 1;
 				update_slacks(inst, j, delta_up);
-				inst->objval += obj_deltaplus;
+				neumaier_add(&(inst->objval), &(inst->objval_comp), obj_deltaplus);
 			}
 			// [] Adding delta_down to x_j improves objval more
 			else if (positive(obj_deltaminus) && greater_than(obj_deltaminus, obj_deltaplus)) {
@@ -527,8 +666,8 @@ int round_xj_bestobj(INSTANCE* inst, int j, double objcoef, double delta_up, dou
 				
 				print_verbose(20, "[round_xj_bestobj]: >>> Round x_%d = %f - %f = %f\n", j + 1, inst->x[j], delta_down, inst->x[j] - delta_down);
 				
-				// If xj is integer (not fractional) then delta_down[j] should be 1.0
-				assert(xj_fractional || equals(delta_down, 1.0));
+				// If xj is integer (not fractional) then delta_down[j] should be integral
+				assert(xj_fractional || !is_fractional(delta_down));
 
 				// Check whether all affected constraints have enough slack for a ROUND DOWN of xj
 				check_slacks(inst, j, delta_up, delta_down, 'D');
@@ -536,21 +675,21 @@ int round_xj_bestobj(INSTANCE* inst, int j, double objcoef, double delta_up, dou
 				// (1) Assume xj fractional will be rounded to an integer
 				if (xj_fractional) {
 					(*num_toround)--;
-					*solfrac -= fractionality(inst->x[j]);
+					neumaier_add(solfrac, &(inst->solfrac_comp), -fractionality(inst->x[j]));
 				}
 
-				// Round DOWN (if xj is not fractional then delta_down[j] must be 1.0)
+				// Round DOWN (if xj is not fractional then delta_down[j] must be integral)
 				inst->x[j] -= delta_down;
 
 				// (2) If xj was not rounded to an integer
 				if (is_fractional(inst->x[j])) {
 					(*num_toround)++;
-					*solfrac += fractionality(inst->x[j]);
+					neumaier_add(solfrac, &(inst->solfrac_comp), fractionality(inst->x[j]));
 				}
 
 				updated = 1;
 				update_slacks(inst, j, -(delta_down));
-				inst->objval += obj_deltaminus;
+				neumaier_add(&(inst->objval), &(inst->objval_comp), obj_deltaminus);
 			}
 			// [] Both deltas improve objval of the same amount > 0 --> Round arbitrarily (DOWN)
 			else if (equals(obj_deltaminus, obj_deltaplus) && positive(obj_deltaminus)) {
@@ -566,7 +705,7 @@ int round_xj_bestobj(INSTANCE* inst, int j, double objcoef, double delta_up, dou
 				// (1) Assume xj fractional will be rounded to an integer
 				if (xj_fractional) {
 					(*num_toround)--;
-					*solfrac -= fractionality(inst->x[j]);
+					neumaier_add(solfrac, &(inst->solfrac_comp), -fractionality(inst->x[j]));
 				}
 
 				// Round arbitrarily (DOWN)
@@ -575,12 +714,12 @@ int round_xj_bestobj(INSTANCE* inst, int j, double objcoef, double delta_up, dou
 				// (2) If xj was not rounded to an integer
 				if (is_fractional(inst->x[j])) {
 					(*num_toround)++;
-					*solfrac += fractionality(inst->x[j]);
+					neumaier_add(solfrac, &(inst->solfrac_comp), fractionality(inst->x[j]));
 				}
 
 				updated = 1;
 				update_slacks(inst, j, -(delta_down));
-				inst->objval += obj_deltaminus;
+				neumaier_add(&(inst->objval), &(inst->objval_comp), obj_deltaminus);
 			}
 			// [] Both deltas do not change objval (both = 0) --> Round arbitrarily (UP)
 			else if (zero(obj_deltaplus) && zero(obj_deltaminus)) {
@@ -596,7 +735,7 @@ int round_xj_bestobj(INSTANCE* inst, int j, double objcoef, double delta_up, dou
 				// (1) Assume xj fractional will be rounded to an integer
 				if (xj_fractional) {
 					(*num_toround)--;
-					*solfrac -= fractionality(inst->x[j]);
+					neumaier_add(solfrac, &(inst->solfrac_comp), -fractionality(inst->x[j]));
 				}
 
 				// Round arbitrarily (UP)
@@ -605,7 +744,7 @@ int round_xj_bestobj(INSTANCE* inst, int j, double objcoef, double delta_up, dou
 				// (2) If xj was not rounded to an integer
 				if (is_fractional(inst->x[j])) {
 					(*num_toround)++;
-					*solfrac += fractionality(inst->x[j]);
+					neumaier_add(solfrac, &(inst->solfrac_comp), fractionality(inst->x[j]));
 				}
 
 				updated = 1;
@@ -646,8 +785,8 @@ int round_xj_worstobj(INSTANCE* inst, int j, double objcoef, double delta_up, do
 
 				print_verbose(20, "[round_xj_bestobj]: >>> Round x_%d = %f - %f = %f\n", j + 1, inst->x[j], delta_down, inst->x[j] - delta_down);
 
-				// If xj is integer (not fractional) then delta_down[j] should be 1.0
-				assert(xj_fractional || equals(delta_down, 1.0));
+				// If xj is integer (not fractional) then delta_down[j] should be integral
+				assert(xj_fractional || !is_fractional(delta_down));
 
 				// Check whether all affected constraints have enough slack for a ROUND DOWN of xj
 				check_slacks(inst, j, delta_up, delta_down, 'D');
@@ -655,21 +794,21 @@ int round_xj_worstobj(INSTANCE* inst, int j, double objcoef, double delta_up, do
 				// (1) Assume xj fractional will be rounded to an integer
 				if (xj_fractional) {
 					(*num_toround)--;
-					*solfrac -= fractionality(inst->x[j]);
+					neumaier_add(solfrac, &(inst->solfrac_comp), -fractionality(inst->x[j]));
 				}
 
-				// Round DOWN (if xj is not fractional then delta_down[j] must be 1.0)
+				// Round DOWN (if xj is not fractional then delta_down[j] must be integral)
 				inst->x[j] -= delta_down;
 
 				// (2) If xj was not rounded to an integer
 				if (is_fractional(inst->x[j])) {
 					(*num_toround)++;
-					*solfrac += fractionality(inst->x[j]);
+					neumaier_add(solfrac, &(inst->solfrac_comp), fractionality(inst->x[j]));
 				}
 
 				updated = 1;
 				update_slacks(inst, j, -(delta_down));
-				inst->objval += obj_deltaminus;
+				neumaier_add(&(inst->objval), &(inst->objval_comp), obj_deltaminus);
 			}
 			// [] Adding -delta_down to x_j improves objval more -> ROUND UP to worsen it
 			else if (negative(obj_deltaminus) && less_than(obj_deltaminus, obj_deltaplus)) {
@@ -679,8 +818,8 @@ int round_xj_worstobj(INSTANCE* inst, int j, double objcoef, double delta_up, do
 
 				print_verbose(20, "[round_xj_bestobj]: >>> Round x_%d = %f + %f = %f\n", j + 1, inst->x[j], delta_up, inst->x[j] + delta_up);
 
-				// If xj is integer (not fractional) then delta_up[j] should be 1.0
-				assert(xj_fractional || equals(delta_up, 1.0));
+				// If xj is integer (not fractional) then delta_up[j] should be integral
+				assert(xj_fractional || !is_fractional(delta_up));
 
 				// Check whether all affected constraints have enough slack for a ROUND UP of xj
 				check_slacks(inst, j, delta_up, delta_down, 'U');
@@ -688,21 +827,21 @@ int round_xj_worstobj(INSTANCE* inst, int j, double objcoef, double delta_up, do
 				// (1) Assume xj fractional will be rounded to an integer
 				if (xj_fractional) {
 					(*num_toround)--;
-					*solfrac -= fractionality(inst->x[j]);
+					neumaier_add(solfrac, &(inst->solfrac_comp), -fractionality(inst->x[j]));
 				}
 
-				// Round UP (if xj is not fractional then delta_up[j] must be 1.0)
+				// Round UP (if xj is not fractional then delta_up[j] must be integral)
 				inst->x[j] += delta_up;
 
 				// (2) If xj was not rounded to an integer
 				if (is_fractional(inst->x[j])) {
 					(*num_toround)++;
-					*solfrac += fractionality(inst->x[j]);
+					neumaier_add(solfrac, &(inst->solfrac_comp), fractionality(inst->x[j]));
 				}
 
 				updated = 1;
 				update_slacks(inst, j, delta_up);
-				inst->objval += obj_deltaplus;
+				neumaier_add(&(inst->objval), &(inst->objval_comp), obj_deltaplus);
 			}
 			// [] Both deltas improve objval of the same amount < 0 --> Round arbitrarily (DOWN)
 			else if (equals(obj_deltaminus, obj_deltaplus) && negative(obj_deltaminus)) {
@@ -718,7 +857,7 @@ int round_xj_worstobj(INSTANCE* inst, int j, double objcoef, double delta_up, do
 				// (1) Assume xj fractional will be rounded to an integer
 				if (xj_fractional) {
 					(*num_toround)--;
-					*solfrac -= fractionality(inst->x[j]);
+					neumaier_add(solfrac, &(inst->solfrac_comp), -fractionality(inst->x[j]));
 				}
 
 				// Round arbitrarily (DOWN)
@@ -727,12 +866,12 @@ int round_xj_worstobj(INSTANCE* inst, int j, double objcoef, double delta_up, do
 				// (2) If xj was not rounded to an integer
 				if (is_fractional(inst->x[j])) {
 					(*num_toround)++;
-					*solfrac += fractionality(inst->x[j]);
+					neumaier_add(solfrac, &(inst->solfrac_comp), fractionality(inst->x[j]));
 				}
 
 				updated = 1;
 				update_slacks(inst, j, -(delta_down));
-				inst->objval += obj_deltaminus;
+				neumaier_add(&(inst->objval), &(inst->objval_comp), obj_deltaminus);
 			}
 			// [] Both deltas do not change objval (both = 0) --> Round arbitrarily (UP)
 			else if (zero(obj_deltaplus) && zero(obj_deltaminus)) {
@@ -748,7 +887,7 @@ int round_xj_worstobj(INSTANCE* inst, int j, double objcoef, double delta_up, do
 				// (1) Assume xj fractional will be rounded to an integer
 				if (xj_fractional) {
 					(*num_toround)--;
-					*solfrac -= fractionality(inst->x[j]);
+					neumaier_add(solfrac, &(inst->solfrac_comp), -fractionality(inst->x[j]));
 				}
 
 				// Round arbitrarily (UP)
@@ -757,7 +896,7 @@ int round_xj_worstobj(INSTANCE* inst, int j, double objcoef, double delta_up, do
 				// (2) If xj was not rounded to an integer
 				if (is_fractional(inst->x[j])) {
 					(*num_toround)++;
-					*solfrac += fractionality(inst->x[j]);
+					neumaier_add(solfrac, &(inst->solfrac_comp), fractionality(inst->x[j]));
 				}
 
 				updated = 1;
@@ -778,8 +917,8 @@ int round_xj_worstobj(INSTANCE* inst, int j, double objcoef, double delta_up, do
 
 				print_verbose(20, "[round_xj_bestobj]: >>> Round x_%d = %f - %f = %f\n", j + 1, inst->x[j], delta_down, inst->x[j] + delta_down);
 
-				// If xj is integer (not fractional) then delta_down[j] should be 1.0
-				assert(xj_fractional || equals(delta_down, 1.0));
+				// If xj is integer (not fractional) then delta_down[j] should be integral
+				assert(xj_fractional || !is_fractional(delta_down));
 
 				// Check whether all affected constraints have enough slack for a ROUND DOWN of xj
 				check_slacks(inst, j, delta_up, delta_down, 'D');
@@ -787,21 +926,21 @@ int round_xj_worstobj(INSTANCE* inst, int j, double objcoef, double delta_up, do
 				// (1) Assume xj fractional will be rounded to an integer
 				if (xj_fractional) {
 					(*num_toround)--;
-					*solfrac -= fractionality(inst->x[j]);
+					neumaier_add(solfrac, &(inst->solfrac_comp), -fractionality(inst->x[j]));
 				}
 
-				// Round DOWN (if xj is not fractional then delta_down[j] must be 1.0)
+				// Round DOWN (if xj is not fractional then delta_down[j] must be integral)
 				inst->x[j] -= delta_down;
 
 				// (2) If xj was not rounded to an integer
 				if (is_fractional(inst->x[j])) {
 					(*num_toround)++;
-					*solfrac += fractionality(inst->x[j]);
+					neumaier_add(solfrac, &(inst->solfrac_comp), fractionality(inst->x[j]));
 				}
 
 				updated = 1;
 				update_slacks(inst, j, -(delta_down));
-				inst->objval += obj_deltaminus;
+				neumaier_add(&(inst->objval), &(inst->objval_comp), obj_deltaminus);
 			}
 			// [] Adding delta_down to x_j improves objval more -> ROUND UP to worsen it
 			else if (positive(obj_deltaminus) && greater_than(obj_deltaminus, obj_deltaplus)) {
@@ -811,8 +950,8 @@ int round_xj_worstobj(INSTANCE* inst, int j, double objcoef, double delta_up, do
 
 				print_verbose(20, "[round_xj_bestobj]: >>> Round x_%d = %f + %f = %f\n", j + 1, inst->x[j], delta_up, inst->x[j] + delta_up);
 
-				// If xj is integer (not fractional) then delta_up[j] should be 1.0
-				assert(xj_fractional || equals(delta_up, 1.0));
+				// If xj is integer (not fractional) then delta_up[j] should be integral
+				assert(xj_fractional || !is_fractional(delta_up));
 
 				// Check whether all affected constraints have enough slack for a ROUND UP of xj
 				check_slacks(inst, j, delta_up, delta_down, 'U');
@@ -820,21 +959,21 @@ int round_xj_worstobj(INSTANCE* inst, int j, double objcoef, double delta_up, do
 				// (1) Assume xj fractional will be rounded to an integer
 				if (xj_fractional) {
 					(*num_toround)--;
-					*solfrac -= fractionality(inst->x[j]);
+					neumaier_add(solfrac, &(inst->solfrac_comp), -fractionality(inst->x[j]));
 				}
 
-				// Round UP (if xj is not fractional then delta_up[j] must be 1.0)
+				// Round UP (if xj is not fractional then delta_up[j] must be integral)
 				inst->x[j] += delta_up;
 
 				// (2) If xj was not rounded to an integer
 				if (is_fractional(inst->x[j])) {
 					(*num_toround)++;
-					*solfrac += fractionality(inst->x[j]);
+					neumaier_add(solfrac, &(inst->solfrac_comp), fractionality(inst->x[j]));
 				}
 
 				updated = 1;
 				update_slacks(inst, j, delta_up);
-				inst->objval += obj_deltaplus;
+				neumaier_add(&(inst->objval), &(inst->objval_comp), obj_deltaplus);
 			}
 			// [] Both deltas improve objval of the same amount > 0 --> Round arbitrarily (DOWN)
 			else if (equals(obj_deltaminus, obj_deltaplus) && positive(obj_deltaminus)) {
@@ -850,7 +989,7 @@ int round_xj_worstobj(INSTANCE* inst, int j, double objcoef, double delta_up, do
 				// (1) Assume xj fractional will be rounded to an integer
 				if (xj_fractional) {
 					(*num_toround)--;
-					*solfrac -= fractionality(inst->x[j]);
+					neumaier_add(solfrac, &(inst->solfrac_comp), -fractionality(inst->x[j]));
 				}
 
 				// Round arbitrarily (DOWN)
@@ -859,12 +998,12 @@ int round_xj_worstobj(INSTANCE* inst, int j, double objcoef, double delta_up, do
 				// (2) If xj was not rounded to an integer
 				if (is_fractional(inst->x[j])) {
 					(*num_toround)++;
-					*solfrac += fractionality(inst->x[j]);
+					neumaier_add(solfrac, &(inst->solfrac_comp), fractionality(inst->x[j]));
 				}
 
 				updated = 1;
 				update_slacks(inst, j, -(delta_down));
-				inst->objval += obj_deltaminus;
+				neumaier_add(&(inst->objval), &(inst->objval_comp), obj_deltaminus);
 			}
 			// [] Both deltas do not change objval (both = 0) --> Round arbitrarily (UP)
 			else if (zero(obj_deltaplus) && zero(obj_deltaminus)) {
@@ -880,7 +1019,7 @@ int round_xj_worstobj(INSTANCE* inst, int j, double objcoef, double delta_up, do
 				// (1) Assume xj fractional will be rounded to an integer
 				if (xj_fractional) {
 					(*num_toround)--;
-					*solfrac -= fractionality(inst->x[j]);
+					neumaier_add(solfrac, &(inst->solfrac_comp), -fractionality(inst->x[j]));
 				}
 
 				// Round arbitrarily (UP)
@@ -889,7 +1028,7 @@ int round_xj_worstobj(INSTANCE* inst, int j, double objcoef, double delta_up, do
 				// (2) If xj was not rounded to an integer
 				if (is_fractional(inst->x[j])) {
 					(*num_toround)++;
-					*solfrac += fractionality(inst->x[j]);
+					neumaier_add(solfrac, &(inst->solfrac_comp), fractionality(inst->x[j]));
 				}
 
 				updated = 1;
@@ -910,60 +1049,73 @@ int round_xj_worstobj(INSTANCE* inst, int j, double objcoef, double delta_up, do
 // Whenever it is called, only one variable xj has been updated
 void update_slacks(INSTANCE* inst, int j, double signed_delta) {
 
-	int colend;         /**< Index of the last constraint containing variable \p j. */
+	COL_ITER col;       /**< Iterator over the constraints containing variable \p j. */
 	double aij;         /**< Current constraint coefficient of variable \p j. */
 	int rowind;         /**< Current row index. */
 	double delta_slack; /**< Delta slack of the current constraint (to be distributed). */
 	double curr_slack;  /**< Slack of the current constraint. */
 	double temp_slack;  /**< Support variable for \p delta_slack distribution. */
+	int old_int;        /**< Flag set to 1 iff \p j was at an integer value before the shift. */
+	int new_int;        /**< Flag set to 1 iff \p j is at an integer value after the shift. */
 	double delta_ss;    /**< Delta singletons slack of the current constraint (to be distributed). */
-
-	colend = (j < inst->ncols - 1) ? inst->cmatbeg[j + 1] : inst->nzcnt;
+	ROW_STATE* row;     /**< Hot state of the current row. */
+
+	// [EXTENSION] Integral rows: whether xj was and is at an integer value
+	old_int = 0; new_int = 0;
+	if (inst->num_nonint != NULL) {
+		old_int = inst->x_int[j];
+		new_int = (inst->x[j] == floor(inst->x[j]));
+		inst->x_int[j] = (char)new_int;
+	}
 
 	// Scan constraints of variable j
-	for (int k = inst->cmatbeg[j]; k < colend; k++) {
+	for (col_begin(inst, j, &col); col_next(&col, &rowind, &aij); ) {
 
-		aij = inst->cmatval[k];
-		rowind = inst->cmatind[k];
+		row = &(inst->rows[rowind]);
 		delta_slack = aij * signed_delta;
-		curr_slack = inst->slack[rowind];
+		curr_slack = row->slack;
 		temp_slack = 0.0;
 
-		switch (inst->sense[rowind]) {
+		switch (row->sense) {
 
 			case 'L': // (slack non-negative)
 			case 'G': // (slack non-positive)
 
 				// [EXTENSION] Distinguish inequality constraints with singletons (if singletons enabled)
-				if (inst->singletons && inst->num_singletons[rowind] > 0) {
+				if (row->has_ss) {
 
 					// First, use at most all the row slack available to cover delta_slack
 					temp_slack = curr_slack - delta_slack;
 					// Update row slack
-					inst->slack[rowind] = (inst->sense[rowind] == 'L') ? max(0.0, temp_slack) : min(0.0, temp_slack);
+					row->slack = (row->sense == 'L') ? max(0.0, temp_slack) : min(0.0, temp_slack);
 
 					// If not enough row slack (temp_slack negative for 'L', positive for 'G' constraints), resort to singletons slack
-					if ((inst->sense[rowind] == 'L' && negative(temp_slack)) || (inst->sense[rowind] == 'G' && positive(temp_slack))) {
+					if ((row->sense == 'L' && negative(temp_slack)) || (row->sense == 'G' && positive(temp_slack))) {
 
-						(inst->sense[rowind] == 'L') ? assert(negative(temp_slack)) : assert(positive(temp_slack));
+						(row->sense == 'L') ? assert(negative(temp_slack)) : assert(positive(temp_slack));
 
 						// Delta singletons slack to distribute among the singletons [new_ss = ss + delta_ss (+ because signed delta)]
 						delta_ss = temp_slack; // negative for 'L', positive for 'G' constraints
 
 						// Distribute delta among the singletons, stop when done (delta_ss negative --> singletons slack must decrease)
-						update_singletons(inst, rowind, delta_ss);
+						// [EXTENSION] Lazy singletons: only update the aggregated singletons slack
+						if (inst->lazy_singletons) lazy_update_singletons(inst, rowind, delta_ss);
+						else update_singletons(inst, rowind, delta_ss);
 					}
 					else {
 						// Row slack was enough, already updated
-						(inst->sense[rowind] == 'L') ? assert(non_negative(inst->slack[rowind])) : assert(non_positive(inst->slack[rowind]));
+						(row->sense == 'L') ? assert(non_negative(row->slack)) : assert(non_positive(row->slack));
 					}
 				}
 				else {
 					// Extension disabled OR enabled but zero singletons
 					// Just update row slack
-					print_verbose(201, "[update_slacks][x_%d][row %d '%c']: slack = %f - (%f * %f) = %f\n", j + 1, rowind + 1, inst->sense[rowind], inst->slack[rowind], aij, signed_delta, inst->slack[rowind] - delta_slack);
-					(inst->sense[rowind] == 'L') ? assert(non_negative(inst->slack[rowind] - delta_slack)) : assert(non_positive(inst->slack[rowind] - delta_slack));
-					inst->slack[rowind] -= delta_slack;
+					print_verbose(201, "[update_slacks][x_%d][row %d '%c']: slack = %f - (%f * %f) = %f\n", j + 1, orig_row(inst, rowind) + 1, row->sense, row->slack, aij, signed_delta, row->slack - delta_slack);
+					(row->sense == 'L') ? assert(non_negative(row->slack - delta_slack)) : assert(non_positive(row->slack - delta_slack));
+					row->slack -= delta_slack;
+
+					// [EXTENSION] Integral row: exact slack once all its columns are at integer values
+					if (row->integral && (inst->num_nonint != NULL)) update_integral_row(inst, rowind, aij, inst->x[j] - signed_delta, inst->x[j], old_int, new_int);
 				}
 
 				break;
@@ -971,7 +1123,7 @@ void update_slacks(INSTANCE* inst, int j, double signed_delta) {
 			case 'E':
 
 				// [EXTENSION] Distinguish equality constraints with singletons (if singletons enabled)
-				if (inst->singletons && inst->num_singletons[rowind] > 0) {
+				if (row->has_ss) {
 
 					// Equality constraint --> row slack is always zero
 					
@@ -979,7 +1131,9 @@ void update_slacks(INSTANCE* inst, int j, double signed_delta) {
 					delta_ss = -(delta_slack);
 					
 					// Distribute delta among the singletons, stop when done
-					update_singletons(inst, rowind, delta_ss);
+					// [EXTENSION] Lazy singletons: only update the aggregated singletons slack
+					if (inst->lazy_singletons) lazy_update_singletons(inst, rowind, delta_ss);
+					else update_singletons(inst, rowind, delta_ss);
 				}
 				else {
 					// Extension disabled OR enabled but zero singletons
@@ -989,7 +1143,7 @@ void update_slacks(INSTANCE* inst, int j, double signed_delta) {
 				break;
 
 			default:
-				print_error("[update_slacks]: Constraint sense %c not supported!\n", inst->sense[rowind]);
+				print_error("[update_slacks]: Constraint sense %c not supported!\n", row->sense);
 		} // end switch
 	} // end for
 }
@@ -998,7 +1152,7 @@ void update_slacks(INSTANCE* inst, int j, double signed_delta) {
 void update_singletons(INSTANCE* inst, int rowind, double delta_ss) {
 
 	int beg = inst->rs_beg[rowind]; /**< Begin index of the singletons for constraint rowind. */
-	int singleton_index;            /**< Current singleton index. */
+	SINGLETON* s;                   /**< Record of the current singleton. */
 	double coef;                    /**< Current singleton coefficient. */
 	double s_lb;                    /**< Singleton lower bound. */
 	double s_ub;                    /**< Singleton upper bound. */
@@ -1007,36 +1161,45 @@ void update_singletons(INSTANCE* inst, int rowind, double delta_ss) {
 	double max_s_delta;             /**< Maximum delta coverable by the current singleton. */
 	double s_delta;                 /**< Delta of the current singleton (to be updated). */
 	int s_slack_increase;           /**< Flag set to 1 iff singletons slack should increase, 0 otherwise. */
+	int* skip;                      /**< Skip pointer of the shift direction (offset of its first non-saturated singleton). */
+	int* skip_opposite;             /**< Skip pointer of the opposite direction. */
+	int first_moved;                /**< Offset of the first singleton moved (-1 if none). */
+	int saturated;                  /**< Flag set to 1 iff the current singleton reached its bound. */
 
 	s_slack_increase = (delta_ss >= 0.0);
+	skip = (s_slack_increase) ? &(inst->rs_skip_inc[rowind]) : &(inst->rs_skip_dec[rowind]);
+	skip_opposite = (s_slack_increase) ? &(inst->rs_skip_dec[rowind]) : &(inst->rs_skip_inc[rowind]);
+	first_moved = -1;
 
 	// Update singletons slack value (should be possible because of function check_slacks)
 	inst->ss_val[rowind] += delta_ss; // + because signed delta
 	assert(var_in_bounds(inst->ss_val[rowind], inst->ss_lb[rowind], inst->ss_ub[rowind]));
+	refresh_row_singletons(inst, rowind);
 
 	// Distribute delta among the singletons, stop when done (delta_ss positive(negative) --> singletons slack must increase(decrease))
-	for (int k = 0; k < inst->num_singletons[rowind]; k++) {
+	// [EXTENSION] Start from the first singleton that is not saturated in this direction (the ones before cannot cover anything)
+	for (int k = *skip; k < inst->num_singletons[rowind]; k++) {
 
 		// Stop updating the singletons when delta singletons slack has been covered (s_slack_increase in the two conditions is necessary...)
 		if ((s_slack_increase && non_positive(delta_ss)) || (!s_slack_increase &&  non_negative(delta_ss))) {
-			print_verbose(200, "[update_singletons][singletons][row %d '%c']: delta_ss covered, found %f\n", rowind + 1, inst->sense[rowind], delta_ss);
+			print_verbose(200, "[update_singletons][singletons][row %d '%c']: delta_ss covered, found %f\n", orig_row(inst, rowind) + 1, inst->sense[rowind], delta_ss);
 			break;
 		}
 		(s_slack_increase) ? assert(non_negative(delta_ss)) : assert(non_positive(delta_ss));
-		print_verbose(120, "[update_slacks][singletons][row %d '%c']: Remaining delta singletons slack to distribute: %f.\n", rowind + 1, inst->sense[rowind], delta_ss);
+		print_verbose(120, "[update_slacks][singletons][row %d '%c']: Remaining delta singletons slack to distribute: %f.\n", orig_row(inst, rowind) + 1, inst->sense[rowind], delta_ss);
 
-		// Singleton info
+		// Singleton info (packed record, the value is written back to x by store_singletons)
 		assert(index_in_bounds(beg + k, inst->rs_size));
-		singleton_index = inst->row_singletons[beg + k];
-		assert(index_in_bounds(singleton_index, inst->ncols));
-		coef = inst->rs_coef[beg + k];
-		s_lb = inst->lb[singleton_index];
-		s_ub = inst->ub[singleton_index];
-		s_val = inst->x[singleton_index];
+		s = &(inst->rs_rec[beg + k]);
+		coef = s->coef;
+		s_lb = s->lb;
+		s_ub = s->ub;
+		s_val = s->val;
 		assert(var_in_bounds(s_val, s_lb, s_ub));
 		covered_delta_ss = 0.0;
 		max_s_delta = 0.0;
 		s_delta = 0.0;
+		saturated = 0;
 
 		// Compute covered delta of the singleton
 		if (coef > 0.0) {
@@ -1044,11 +1207,13 @@ void update_singletons(INSTANCE* inst, int rowind, double delta_ss) {
 				// Singletons slack increase
 				max_s_delta = s_ub - s_val;
 				covered_delta_ss = min(delta_ss, coef * max_s_delta);
+				saturated = (covered_delta_ss == coef * max_s_delta);
 			}
 			else {
 				// Singletons slack decrease
 				max_s_delta = s_val - s_lb;
 				covered_delta_ss = max(delta_ss, -coef * max_s_delta);
+				saturated = (covered_delta_ss == -coef * max_s_delta);
 			}
 		}
 		if (coef < 0.0) {
@@ -1056,29 +1221,180 @@ void update_singletons(INSTANCE* inst, int rowind, double delta_ss) {
 				// Singletons slack increase
 				max_s_delta = s_val - s_lb;
 				covered_delta_ss = min(delta_ss, -coef * max_s_delta);
+				saturated = (covered_delta_ss == -coef * max_s_delta);
 			}
 			else {
 				// Singletons slack decrease
 				max_s_delta = s_ub - s_val;
 				covered_delta_ss = max(delta_ss, coef * max_s_delta);
+				saturated = (covered_delta_ss == coef * max_s_delta);
 			}
 		}
 		// Update remaining delta to be covered by the next singletons
 		delta_ss -= covered_delta_ss;
+		if ((first_moved < 0) && (covered_delta_ss != 0.0)) first_moved = k;
 
 		// Compute singleton delta
 		s_delta = covered_delta_ss / coef;
-		// Update singleton
+		// Update singleton (exactly to its bound if saturated, so that the skip pointers can pass it)
 		assert(var_in_bounds(s_val + s_delta, s_lb, s_ub));
-		inst->x[singleton_index] = s_val + s_delta;
+		s->val = (saturated) ? (((coef > 0.0) == s_slack_increase) ? s_ub : s_lb) : s_val + s_delta;
+		s_delta = s->val - s_val;
 
 		// Update objective value
-		inst->objval += (inst->obj[singleton_index] * s_delta);
+		neumaier_add(&(inst->objval), &(inst->objval_comp), s->obj * s_delta);
 	} // end for
 
 	// Delta slack must have been distributed among the singletons
 	assert(zero(delta_ss));
-	print_verbose(120, "[update_singletons][singletons][row %d '%c']: delta_ss distributed, remaining %f\n", rowind + 1, inst->sense[rowind], delta_ss);
+	print_verbose(120, "[update_singletons][singletons][row %d '%c']: delta_ss distributed, remaining %f\n", orig_row(inst, rowind) + 1, inst->sense[rowind], delta_ss);
+
+	// [EXTENSION] Advance the skip pointer past the saturated singletons, the moved ones can now go back in the opposite direction
+	while ((*skip < inst->num_singletons[rowind]) && singleton_saturated(inst, beg + *skip, s_slack_increase)) (*skip)++;
+	if ((first_moved >= 0) && (first_moved < *skip_opposite)) *skip_opposite = first_moved;
+}
+
+// [EXTENSION]
+int singleton_saturated(INSTANCE* inst, int k, int s_slack_increase) {
+
+	const SINGLETON* s = &(inst->rs_rec[k]); /**< Record of the singleton. */
+
+	// The singletons slack increases when the singleton moves towards its upper bound (positive coefficient) or lower bound (negative coefficient)
+	if ((s->coef > 0.0) == s_slack_increase) return (s->val == s->ub);
+	return (s->val == s->lb);
+}
+
+// [EXTENSION]
+void load_singletons(INSTANCE* inst) {
+
+	if (!(inst->singletons)) return;
+	for (int k = 0; k < inst->rs_size; k++) inst->rs_rec[k].val = inst->x[inst->rs_rec[k].col];
+}
+
+// [EXTENSION]
+void store_singletons(INSTANCE* inst) {
+
+	if (!(inst->singletons)) return;
+	for (int k = 0; k < inst->rs_size; k++) inst->x[inst->rs_rec[k].col] = inst->rs_rec[k].val;
+}
+
+// [EXTENSION]
+void load_integral_rows(INSTANCE* inst) {
+
+	COL_ITER col; /**< Iterator over the constraints containing variable x_j. */
+	int rowind;   /**< Current row index. */
+	double aij;   /**< Current constraint coefficient. */
+
+	if (!(inst->int_rows)) return;
+
+	// Allocate
+	inst->int_act = (long long*)calloc((size_t)max(inst->nrows, 1), sizeof(long long));
+	inst->num_nonint = (int*)calloc((size_t)max(inst->nrows, 1), sizeof(int));
+	inst->x_int = (char*)malloc((size_t)inst->ncols * sizeof(char));
+	if (inst->int_act == NULL || inst->num_nonint == NULL || inst->x_int == NULL) print_error("[load_integral_rows]: Failed to allocate integral rows.\n");
+
+	// Exact activities over the columns at an integer value, count the other ones
+	for (int j = 0; j < inst->ncols; j++) {
+		inst->x_int[j] = (inst->x[j] == floor(inst->x[j]));
+		for (col_begin(inst, j, &col); col_next(&col, &rowind, &aij); ) {
+			if (!(inst->rows[rowind].integral)) continue;
+			if (inst->x_int[j]) inst->int_act[rowind] += (long long)aij * (long long)(inst->x[j]);
+			else inst->num_nonint[rowind]++;
+		}
+	}
+
+	// Exact slacks of the rows with all their columns at integer values
+	for (int i = 0; i < inst->nrows; i++) {
+		if (inst->rows[i].integral && (inst->num_nonint[i] == 0)) {
+			assert(equals(inst->rows[i].slack, (double)((long long)(inst->rhs[i]) - inst->int_act[i])));
+			inst->rows[i].slack = (double)((long long)(inst->rhs[i]) - inst->int_act[i]);
+		}
+	}
+}
+
+// [EXTENSION]
+void free_integral_rows(INSTANCE* inst) {
+
+	free_all(3, inst->int_act, inst->num_nonint, inst->x_int);
+	inst->int_act = NULL; inst->num_nonint = NULL; inst->x_int = NULL;
+}
+
+// [EXTENSION]
+void update_integral_row(INSTANCE* inst, int rowind, double aij, double xold, double xnew, int old_int, int new_int) {
+
+	// Previous value (exact up to the rounding of x_new - shift, removed by round)
+	if (old_int) inst->int_act[rowind] -= (long long)aij * (long long)round(xold);
+	else inst->num_nonint[rowind]--;
+
+	// Current value
+	if (new_int) inst->int_act[rowind] += (long long)aij * (long long)xnew;
+	else inst->num_nonint[rowind]++;
+	assert(inst->num_nonint[rowind] >= 0);
+
+	// All the columns at integer values: the slack is an exact integer (drift removed)
+	if (inst->num_nonint[rowind] == 0) {
+		assert(equals(inst->rows[rowind].slack, (double)((long long)(inst->rhs[rowind]) - inst->int_act[rowind])));
+		inst->rows[rowind].slack = (double)((long long)(inst->rhs[rowind]) - inst->int_act[rowind]);
+	}
+}
+
+// [EXTENSION]
+void resync_state(INSTANCE* inst) {
+
+	double objval;  /**< Objective value. */
+	double solfrac; /**< Solution fractionality. */
+	double* rowact; /**< Row activities (column by column, CSC-only mode). */
+	COL_ITER col;   /**< Iterator over the constraints containing the current variable. */
+	int rowind;     /**< Current row index. */
+	double aij;     /**< Current constraint coefficient. */
+
+	// Singleton values into the solution (their records stay loaded, unchanged)
+	store_singletons(inst);
+
+	// Objective value and solution fractionality
+	objval = 0.0;
+	solfrac = 0.0;
+	#pragma omp parallel for reduction(+:objval, solfrac)
+	for (int j = 0; j < inst->ncols; j++) {
+		objval += inst->obj[j] * inst->x[j];
+		if (inst->int_var[j]) solfrac += fractionality(inst->x[j]);
+	}
+	print_verbose(20, "[resync_state]: Drift of objective %e, of fractionality %e.\n", inst->objval + inst->objval_comp - objval, inst->solfrac + inst->solfrac_comp - solfrac);
+	inst->objval = objval; inst->objval_comp = 0.0;
+	inst->solfrac = solfrac; inst->solfrac_comp = 0.0;
+
+	// Slacks of the inequality rows without singletons (the singletons slacks absorb the drift of the other rows)
+	if (inst->rmatbeg != NULL) {
+		#pragma omp parallel for
+		for (int i = 0; i < inst->nrows; i++) {
+			double act = 0.0;
+			if (inst->rows[i].has_ss || (inst->rows[i].sense == 'E')) continue;
+			for (nzind_t h = inst->rmatbeg[i]; h < inst->rmatbeg[i + 1]; h++) act += inst->rmatval[h] * inst->x[inst->rmatind[h]];
+			inst->rows[i].slack = inst->rhs[i] - act;
+		}
+	}
+	else {
+		rowact = (double*)calloc((size_t)max(inst->nrows, 1), sizeof(double)); if (rowact == NULL) print_error("[resync_state]: Failed to allocate row activities.\n");
+		for (int j = 0; j < inst->ncols; j++) {
+			if (inst->x[j] == 0.0) continue;
+			for (col_begin(inst, j, &col); col_next(&col, &rowind, &aij); ) rowact[rowind] += aij * inst->x[j];
+		}
+		for (int i = 0; i < inst->nrows; i++) {
+			if (inst->rows[i].has_ss || (inst->rows[i].sense == 'E')) continue;
+			inst->rows[i].slack = inst->rhs[i] - rowact[i];
+		}
+		free(rowact);
+	}
+}
+
+// [EXTENSION]
+void reset_singletons_skips(INSTANCE* inst) {
+
+	if (!(inst->singletons)) return;
+	for (int i = 0; i < inst->nrows; i++) {
+		inst->rs_skip_inc[i] = 0;
+		inst->rs_skip_dec[i] = 0;
+	}
 }
 
 void delta_updown(INSTANCE* inst, int j, double* delta_up, double* delta_down, const double epsilon) {
@@ -1091,15 +1407,13 @@ void delta_updown(INSTANCE* inst, int j, double* delta_up, double* delta_down, c
 	double candidate_down1;  /**< Current delta_down[j] minor candidate. */
 	double new_delta_up;     /**< Final delta_up[j] winner. */
 	double new_delta_down;   /**< Final delta_down[j] winner. */
-	int colend;				 /**< Index of the last constraint containing variable x_j. */
+	COL_ITER col;            /**< Iterator over the constraints containing variable x_j. */
 	double aij;              /**< Coefficient of xj in the constraint. */
 	int rowind;              /**< Constraint index. */
 	double slack;            /**< Row slack (no singleton slack included). */
-	double ss_lb;            /**< Lower bound of singletons slack (in its row). */
-	double ss_ub;            /**< Upper bound of singletons slack (in its row). */
-	double singletons_slack; /**< Singletons slack value (in its row). */
 	double ss_delta_up;      /**< Maximum delta up for current singletons slack. */
 	double ss_delta_down;    /**< Maximum delta down for current singletons slack. */
+	ROW_STATE* row;          /**< Hot state of the current row (one record per nonzero scanned). */
 
 	delta_up[j] = 0.0;
 	delta_down[j] = 0.0;
@@ -1111,36 +1425,29 @@ void delta_updown(INSTANCE* inst, int j, double* delta_up, double* delta_down, c
 		non_negative(delta_up2) & 
 		non_negative(delta_down2)
 	);
-	colend = (j < inst->ncols - 1) ? inst->cmatbeg[j + 1] : inst->nzcnt;
 	
 	print_verbose(201, "[delta_updown]: delta_up2_%d = ub_%d - x_%d = %f - %f = %f ; delta_down2_%d = x_%d - lb_%d = %f - %f = %f\n", j + 1, j + 1, j + 1, inst->ub[j], inst->x[j], delta_up2, j + 1, j + 1, j + 1, inst->x[j], inst->lb[j], delta_down2);
 
 	// Scan constraints of variable xj
-	for (int k = inst->cmatbeg[j]; k < colend; k++) {
+	for (col_begin(inst, j, &col); col_next(&col, &rowind, &aij); ) {
 
-		aij = inst->cmatval[k];
-		rowind = inst->cmatind[k];
 		assert(index_in_bounds(rowind, inst->nrows));
-		slack = inst->slack[rowind]; // (no singleton slack included)
+		row = &(inst->rows[rowind]);
+		slack = row->slack; // (no singleton slack included)
 
 		// [EXTENSION] Get singletons slack info (if any)
-		ss_lb = LONG_MAX;
-		ss_ub = LONG_MIN;
-		singletons_slack = 0.0;
 		ss_delta_up = 0.0;
 		ss_delta_down = 0.0;
-		if (inst->singletons && inst->num_singletons[rowind] > 0) {
+		if (row->has_ss) {
 
-			// Compute singletons slack of constraint rowind and get bounds
-			ss_lb = inst->ss_lb[rowind];
-			ss_ub = inst->ss_ub[rowind];
-			singletons_slack = inst->ss_val[rowind]; // compute_ss_val(inst, rowind);
-			assert(equals(singletons_slack, compute_ss_val(inst, rowind)));
-			assert(var_in_bounds(singletons_slack, ss_lb, ss_ub));
+			// Singletons slack deltas of constraint rowind (kept in the row record)
+			assert(inst->lazy_singletons || equals(inst->ss_val[rowind], compute_ss_val(inst, rowind)));
+			assert(var_in_bounds(inst->ss_val[rowind], inst->ss_lb[rowind], inst->ss_ub[rowind]));
+			assert(equals(row->ss_up, inst->ss_ub[rowind] - inst->ss_val[rowind]) && equals(row->ss_down, inst->ss_val[rowind] - inst->ss_lb[rowind]));
 
 			// Compute singletons slack deltas (clip to zero if slightly non-positive)
-			ss_delta_up = ss_ub - singletons_slack;
-			ss_delta_down = singletons_slack - ss_lb;
+			ss_delta_up = row->ss_up;
+			ss_delta_down = row->ss_down;
 			if ((ss_delta_up < 0.0) && (ss_delta_up > -(TOLERANCE))) ss_delta_up = 0.0;
 			if ((ss_delta_down < 0.0) && (ss_delta_down > -(TOLERANCE))) ss_delta_down = 0.0;
 			assert(
@@ -1150,21 +1457,27 @@ void delta_updown(INSTANCE* inst, int j, double* delta_up, double* delta_down, c
 		}
 		
 		// Check sense, then check sign of aij, and update delta_up1, delta_down1
-		switch (inst->sense[rowind]) {
+		switch (row->sense) {
 
 			case 'L': // (slack non-negative)
 
-				if (negative(inst->slack[rowind])) print_error("[delta_updown][row %d 'L']: Found negative row slack = %f\n", rowind + 1, inst->slack[rowind]);
+				// [EXTENSION] Integral row with all its columns at integer values: exact slack, no tolerance checks
+				if (row->integral && (inst->num_nonint != NULL) && (inst->num_nonint[rowind] == 0)) {
+					integral_ratio(row->sense, row->slack, aij, &delta_up1, &delta_down1);
+					break;
+				}
+
+				if (negative(row->slack)) print_error("[delta_updown][row %d 'L']: Found negative row slack = %f\n", orig_row(inst, rowind) + 1, row->slack);
 
 				// Clip slack to zero if slightly negative
-				if ((inst->slack[rowind] < 0.0) && (inst->slack[rowind] >= -(TOLERANCE))) { 
-					inst->slack[rowind] = 0.0; 
-					slack = inst->slack[rowind]; 
+				if ((row->slack < 0.0) && (row->slack >= -(TOLERANCE))) { 
+					row->slack = 0.0; 
+					slack = row->slack; 
 				}
-				assert(equals(slack, inst->slack[rowind]));
+				assert(equals(slack, row->slack));
 
 				// [EXTENSION] Update available slack: 'L' constraint --> singletons slack (if any) should decrease
-				if (inst->singletons && inst->num_singletons[rowind] > 0) slack += ss_delta_down; // overall slack increases
+				if (row->has_ss) slack += ss_delta_down; // overall slack increases
 
 				if (aij > 0.0) { 
 					
@@ -1187,17 +1500,23 @@ void delta_updown(INSTANCE* inst, int j, double* delta_up, double* delta_down, c
 
 			case 'G': // (slack non-positive)
 
-				if (positive(inst->slack[rowind])) print_error("[delta_updown][row %d 'G']: Found positive row slack = %f\n", rowind + 1, inst->slack[rowind]);
+				// [EXTENSION] Integral row with all its columns at integer values: exact slack, no tolerance checks
+				if (row->integral && (inst->num_nonint != NULL) && (inst->num_nonint[rowind] == 0)) {
+					integral_ratio(row->sense, row->slack, aij, &delta_up1, &delta_down1);
+					break;
+				}
+
+				if (positive(row->slack)) print_error("[delta_updown][row %d 'G']: Found positive row slack = %f\n", orig_row(inst, rowind) + 1, row->slack);
 
 				// Clip slack to zero if slightly positive
-				if ((inst->slack[rowind] > 0.0) && (inst->slack[rowind] <= TOLERANCE)) { 
-					inst->slack[rowind] = 0.0;
-					slack = inst->slack[rowind];
+				if ((row->slack > 0.0) && (row->slack <= TOLERANCE)) { 
+					row->slack = 0.0;
+					slack = row->slack;
 				}
-				assert(equals(slack, inst->slack[rowind]));
+				assert(equals(slack, row->slack));
 
 				// [EXTENSION] Update available slack: 'G' constraint --> singletons slack (if any) should increase
-				if (inst->singletons && inst->num_singletons[rowind] > 0) slack -= ss_delta_up; // overall slack decreases (increases in absolute value)
+				if (row->has_ss) slack -= ss_delta_up; // overall slack decreases (increases in absolute value)
 
 				if (aij < 0.0) {
 
@@ -1221,10 +1540,10 @@ void delta_updown(INSTANCE* inst, int j, double* delta_up, double* delta_down, c
 			case 'E': // (slack zero if singletons disabled)
 
 				// [EXTENSION] Distinguish equality constraints with singletons (if singletons enabled)
-				if (inst->singletons && inst->num_singletons[rowind] > 0) {
+				if (row->has_ss) {
 
 					// Compute singletons slack of constraint rowind and get bounds (done above)
-					print_verbose(201, "Singletons slack = %f. Bounds %f <= ss <= %f\n", singletons_slack, ss_lb, ss_ub);
+					print_verbose(201, "Singletons slack = %f. Bounds %f <= ss <= %f\n", inst->ss_val[rowind], inst->ss_lb[rowind], inst->ss_ub[rowind]);
 					// Compute singletons slack deltas (done above)
 
 					// Update candidate deltas
@@ -1265,7 +1584,7 @@ void delta_updown(INSTANCE* inst, int j, double* delta_up, double* delta_down, c
 				}
 				else {
 					// Extension disabled OR enabled but zero singletons
-					print_verbose(201, "[delta_updown][x_%d][row %d '%c']: Slack ZERO (no singletons) --> x_%d cannot be moved!\n", j + 1, rowind + 1, inst->sense[rowind], j + 1);
+					print_verbose(201, "[delta_updown][x_%d][row %d '%c']: Slack ZERO (no singletons) --> x_%d cannot be moved!\n", j + 1, orig_row(inst, rowind) + 1, row->sense, j + 1);
 
 					// Set delta_up1 and delta_down1 to zero --> new_delta_up and new_delta_down will get value zero
 					delta_up1 = 0.0;
@@ -1275,7 +1594,7 @@ void delta_updown(INSTANCE* inst, int j, double* delta_up, double* delta_down, c
 				break;
 
 			default:
-				print_error("[delta_updown]: Constraint sense '%c' not included in {'L','G','E'}.\n", inst->sense[rowind]);
+				print_error("[delta_updown]: Constraint sense '%c' not included in {'L','G','E'}.\n", row->sense);
 		}
 	} // end for
 
@@ -1307,16 +1626,115 @@ void delta_updown(INSTANCE* inst, int j, double* delta_up, double* delta_down, c
 	);
 }
 
+// [EXTENSION]
+void integral_ratio(char sense, double slack, double aij, double* delta_up1, double* delta_down1) {
+
+	long long quotient; /**< Largest integral shift allowed by the row. */
+
+	// Room left (|slack|, exact) over the coefficient magnitude: floor division of non-negative integers
+	quotient = llabs((long long)slack) / llabs((long long)aij);
+
+	// Up-shifts consume the room of 'L' rows with positive coefficients and of 'G' rows with negative ones
+	if ((sense == 'L') == (aij > 0.0)) *delta_up1 = min(*delta_up1, (double)quotient);
+	else *delta_down1 = min(*delta_down1, (double)quotient);
+}
+
+void integral_deltas(INSTANCE* inst, int j, double* delta_up, double* delta_down) {
+
+	// Calculate deltas (with epsilon = 1.0)
+	delta_updown(inst, j, delta_up, delta_down, 1.0);
+	assert(
+		var_in_bounds(inst->x[j] + delta_up[j], inst->lb[j], inst->ub[j]) & 
+		var_in_bounds(inst->x[j] - delta_down[j], inst->lb[j], inst->ub[j])
+	);
+
+	integral_shifts(inst, j, delta_up, delta_down);
+}
+
+// [EXTENSION]
+void integral_shifts(INSTANCE* inst, int j, double* delta_up, double* delta_down) {
+
+	// Keep only integral shifts: the largest one within the deltas (multi-unit shifts) or exactly one unit
+	if (inst->multi_shift) {
+		delta_up[j] = floor(delta_up[j] + TOLERANCE);
+		delta_down[j] = floor(delta_down[j] + TOLERANCE);
+	}
+	else {
+		delta_up[j] = (equals(delta_up[j], 1.0)) ? 1.0 : 0.0;
+		delta_down[j] = (equals(delta_down[j], 1.0)) ? 1.0 : 0.0;
+	}
+}
+
+// [EXTENSION]
+void priority_order(INSTANCE* inst, int* order, int* pushed, HEAP* heap, double* delta_up, double* delta_down, const double epsilon) {
+
+	COL_ITER col;      /**< Iterator over the constraints containing the current variable. */
+	int rowind;        /**< Current row index. */
+	double aij;        /**< Current constraint coefficient. */
+	double ZI;         /**< Fractionality of the current variable. */
+	double ZIbest;     /**< Smallest fractionality reachable by a shift of the current variable. */
+	double shift;      /**< Shift that reaches ZIbest. */
+	double consumed;   /**< Slack consumed by the shift (sum of the absolute row activity changes). */
+	double key;        /**< Priority of the current variable. */
+	int stamp;         /**< Stamp of the popped entry (unused, entries are never stale here). */
+	int num_ordered;   /**< Number of columns already placed in the visit order. */
+
+	heap->size = 0;
+	num_ordered = 0;
+
+	for (int j = 0; j < inst->ncols; j++) pushed[j] = 0;
+
+	// Push the fractional columns that can be improved, keyed by priority (scanned in the visit order of the instance)
+	for (int idx = 0; idx < inst->ncols; idx++) {
+
+		int j = (inst->perm != NULL) ? inst->perm[idx] : idx;
+		if (!(inst->int_var[j]) || equals(inst->lb[j], inst->ub[j]) || !is_fractional(inst->x[j])) continue;
+
+		ZI = fractionality(inst->x[j]);
+		switch (inst->col_order) {
+
+			// Closeness to an integer
+			case 1:
+				key = 0.5 - ZI;
+				break;
+
+			// Expected fractionality reduction per unit of slack consumed
+			case 2:
+				delta_updown(inst, j, delta_up, delta_down, epsilon);
+				ZIbest = ZI; shift = 0.0;
+				if (less_than(fractionality(inst->x[j] + delta_up[j]), ZIbest)) { ZIbest = fractionality(inst->x[j] + delta_up[j]); shift = delta_up[j]; }
+				if (less_than(fractionality(inst->x[j] - delta_down[j]), ZIbest)) { ZIbest = fractionality(inst->x[j] - delta_down[j]); shift = delta_down[j]; }
+				if (zero(shift)) continue;
+				consumed = 0.0;
+				for (col_begin(inst, j, &col); col_next(&col, &rowind, &aij); ) consumed += fabs(aij) * shift;
+				key = (ZI - ZIbest) / max(consumed, TOLERANCE);
+				break;
+
+			default:
+				print_error("[priority_order]: Column order %d not supported.\n", inst->col_order);
+		}
+
+		heap_push(heap, j, key, 0);
+		pushed[j] = 1;
+	}
+
+	// Visit order: columns by decreasing priority, then the remaining ones in the visit order of the instance
+	while (heap->size > 0) heap_pop(heap, &(order[num_ordered++]), &key, &stamp);
+	for (int idx = 0; idx < inst->ncols; idx++) {
+		int j = (inst->perm != NULL) ? inst->perm[idx] : idx;
+		if (!pushed[j]) order[num_ordered++] = j;
+	}
+	assert(num_ordered == inst->ncols);
+}
+
 // [EXTENSION]
 double compute_ss_val(INSTANCE* inst, int rowind) {
 
 	assert(index_in_bounds(rowind, inst->nrows));
-	if (inst->num_singletons[rowind] <= 0) print_error("[compute_ss_val][singletons]: Tried to compute singletons slack of row %d with no singletons.\n", rowind + 1);
+	if (inst->num_singletons[rowind] <= 0) print_error("[compute_ss_val][singletons]: Tried to compute singletons slack of row %d with no singletons.\n", orig_row(inst, rowind) + 1);
 
 	double singletons_slack; /**< Current singletons slack value. */
 	int beg;                 /**< Begin index of singleton indices for row \p rowind. */
-	int singleton_index;     /**< Current singleton index. */
-	double coef;             /**< Current singleton coefficient in row \p rowind. */
 
 	// Compute singletons slack
 	singletons_slack = 0.0;
@@ -1325,12 +1743,46 @@ double compute_ss_val(INSTANCE* inst, int rowind) {
 	for (int k = 0; k < inst->num_singletons[rowind]; k++) {
 
 		assert(index_in_bounds(beg + k, inst->rs_size));
-		singleton_index = inst->row_singletons[beg + k];
-		assert(index_in_bounds(singleton_index, inst->ncols));
-		coef = inst->rs_coef[beg + k];
-		singletons_slack += (coef * inst->x[singleton_index]);
+		singletons_slack += (inst->rs_rec[beg + k].coef * inst->rs_rec[beg + k].val);
 	}
 	assert(var_in_bounds(singletons_slack, inst->ss_lb[rowind], inst->ss_ub[rowind]));
 
 	return singletons_slack;
-}
\ No newline at end of file
+}
+
+// [EXTENSION]
+void lazy_update_singletons(INSTANCE* inst, int rowind, double delta_ss) {
+
+	// Update singletons slack value only (should be possible because of function check_slacks)
+	inst->ss_val[rowind] += delta_ss; // + because signed delta
+	assert(var_in_bounds(inst->ss_val[rowind], inst->ss_lb[rowind], inst->ss_ub[rowind]));
+	refresh_row_singletons(inst, rowind);
+}
+
+// [EXTENSION]
+void materialize_singletons(INSTANCE* inst) {
+
+	double target; /**< Aggregated singletons slack of the current row (to be reached by the singletons). */
+
+	if (!(inst->singletons)) return;
+
+	for (int i = 0; i < inst->nrows; i++) {
+
+		// Skip rows with no singletons
+		if (inst->num_singletons[i] == 0) continue;
+
+		// Restart from the singletons slack of the current singleton values, then distribute the difference
+		target = inst->ss_val[i];
+		inst->ss_val[i] = compute_ss_val(inst, i);
+		if (!zero(target - inst->ss_val[i])) update_singletons(inst, i, target - inst->ss_val[i]);
+		refresh_row_singletons(inst, i);
+	}
+}
+
+// [EXTENSION]
+void refresh_row_singletons(INSTANCE* inst, int rowind) {
+
+	// Room of the singletons slack towards its bounds (same expressions of the ratio test)
+	inst->rows[rowind].ss_up = inst->ss_ub[rowind] - inst->ss_val[rowind];
+	inst->rows[rowind].ss_down = inst->ss_val[rowind] - inst->ss_lb[rowind];
+}
@@ -46,10 +46,254 @@
 #define TOLERANCE 1e-6
 
 /**
- * @brief Threshold used in the ZI-Round heuristic.
+ * @brief Threshold used in the ZI-Round heuristic (final value of the fractional shifts schedule).
  */
 #define EPSILON 1e-5
 
+/**
+ * @brief Type of the positions of the nonzeros of the constraint matrix (begin arrays and nonzero counters).
+ *
+ * @details 32-bit by default, for cache efficiency on normal instances. Define ZI_WIDE_INDEX at build time
+ *          for instances with 2^31 nonzeros or more: the positions become 64-bit and the matrix is read
+ *          with the 64-bit (CPXX) routines of CPLEX. Row and column indices stay 32-bit in both cases.
+ */
+#ifdef ZI_WIDE_INDEX
+typedef CPXNNZ nzind_t;
+#define NZ_FMT "%lld"
+#define ZI_getnumnz CPXXgetnumnz
+#define ZI_getrows CPXXgetrows
+#define ZI_getcols CPXXgetcols
+#else
+typedef int nzind_t;
+#define NZ_FMT "%d"
+#define ZI_getnumnz CPXgetnumnz
+#define ZI_getrows CPXgetrows
+#define ZI_getcols CPXgetcols
+#endif
+
+/**
+ * @brief Alignment in bytes of the sections of the memory-mapped store.
+ */
+#define STORE_ALIGN 64
+
+/**
+ * @brief Maximum number of chunks of columns transposed in parallel when the row view is built on demand.
+ */
+#define ROW_VIEW_CHUNKS 16
+
+/**
+ * @brief Maximum number of distinct coefficients of the dictionary of the compressed columns (one byte codes).
+ */
+#define CSC_DICT_MAX 256
+
+/**
+ * @brief Maximum number of bytes of a row index delta in the compressed columns (32 bits in groups of 7).
+ */
+#define CSC_VARINT_MAX 5
+
+/**
+ * @brief Largest magnitude of the row activities kept in exact integer arithmetic (exact also as a double).
+ */
+#define INT_ROW_MAX 9007199254740992.0
+
+/**
+ * @brief Number of columns of a chunk of the sliced ELLPACK layout (SELL-C-sigma), i.e. of lanes evaluated together.
+ */
+#define SELL_C 8
+
+/**
+ * @brief Number of columns of the windows sorted by length in the sliced ELLPACK layout (sigma).
+ */
+#define SELL_SIGMA 256
+
+/**
+ * @brief Maximum number of parts (groups of connected components) rounded in parallel by the component rounding.
+ */
+#define COMPONENT_PARTS 64
+
+/**
+ * @brief Maximum number of passes of the presolve over the columns and the rows.
+ */
+#define PRESOLVE_PASSES 8
+
+/**
+ * @brief Minimum relative tightening of the bound of a continuous column by the presolve.
+ */
+#define PRESOLVE_MIN_GAIN 1e-3
+
+/**
+ * @brief Binary max-heap of column indices keyed by a priority (e.g. objective gain).
+ *
+ * @details Entries are never updated in place: a column whose key changes is pushed again
+ *          with a new stamp, and the entries with an older stamp are skipped when popped.
+ */
+typedef struct {
+    int* col;                 /**< Column indices of the entries. */
+    double* key;              /**< Keys of the entries (the maximum is on top). */
+    int* stamp;               /**< Stamps of the columns when the entries were pushed. */
+    int size;                 /**< Current number of entries. */
+    int len;                  /**< Maximum number of entries (resizable). */
+} HEAP;
+
+/**
+ * @brief Nonzero of a column (row index and coefficient), used to sort the columns by row index.
+ */
+typedef struct {
+    int ind;                   /**< Row index. */
+    double val;                /**< Coefficient. */
+} NONZERO;
+
+/**
+ * @brief Iterator over the nonzeros of a column, for both the plain and the compressed matrix by columns.
+ *        The layout of the column is chosen once by col_begin, and the arrays are copied in the iterator
+ *        so that the loop does not reload them through the instance.
+ */
+typedef struct {
+    nzind_t k;                 /**< Position of the next nonzero of the column. */
+    nzind_t end;               /**< Position past the last nonzero of the column. */
+    int plain;                 /**< Flag of a plain column (row indices and double coefficients). */
+    const int* ind;            /**< Row indices of the matrix by columns (plain columns only). */
+    const double* val;         /**< Double coefficients of the matrix by columns (NULL if not used). */
+    const float* flt;          /**< Single precision coefficients of the matrix by columns (NULL if not used). */
+    const double* dict;        /**< Dictionary of the distinct coefficients of the compressed columns. */
+    const unsigned char* code; /**< Next byte of the compressed column (NULL for plain columns). */
+    int rowind;                /**< Row index of the previous nonzero (base of the next delta). */
+} COL_ITER;
+
+/**
+ * @brief Sort key of a singleton (objective coefficient, then column index).
+ */
+typedef struct {
+    double obj;               /**< Objective coefficient of the singleton. */
+    int col;                  /**< Column index of the singleton. */
+    double coef;              /**< Coefficient of the singleton in its row. */
+} SINGLETON_KEY;
+
+/**
+ * @brief Memory-mapped file holding the immutable column data of an instance (matrix by columns,
+ *        objective, bounds and variable types), for instances larger than the available memory.
+ */
+typedef struct {
+    HANDLE file;              /**< Backing file (temporary, deleted when the store is closed). */
+    HANDLE mapping;           /**< File mapping. */
+    char* view;               /**< Mapped view of the whole file (NULL if the store is not open). */
+    size_t size;              /**< Size of the file in bytes. */
+    size_t used;              /**< Bytes already assigned to the arrays of the instance. */
+    char path[MAX_PATH];      /**< Path of the backing file. */
+} STORE;
+
+/**
+ * @brief Hot state of a row, packed in a 32-byte record: all the row data read by the ratio
+ *        test (delta_updown) and by the slack updates for each nonzero of a column.
+ *
+ * @details The singletons slack values and bounds (ss_val, ss_lb, ss_ub) stay in their own
+ *          arrays, the record only keeps their distances, refreshed by refresh_row_singletons.
+ */
+typedef struct {
+    double slack;             /**< Row slack, defined as right hand side minus row activity. */
+    double ss_down;           /**< Room of the singletons slack towards its lower bound (ss_val - ss_lb, 0 if no singletons). */
+    double ss_up;             /**< Room of the singletons slack towards its upper bound (ss_ub - ss_val, 0 if no singletons). */
+    char sense;               /**< Constraint sense (copy of the cold array). */
+    char has_ss;              /**< Flag set to 1 iff the singletons are enabled and the row has at least one. */
+    char integral;            /**< Flag set to 1 iff the row has integer coefficients and right hand side, integer columns and no singletons (see find_integral_rows). */
+} ROW_STATE;
+
+/**
+ * @brief Packed record of a singleton, with all the data read when its row singletons slack
+ *        is distributed (the value is a working copy of the solution entry).
+ */
+typedef struct {
+    double coef;              /**< Coefficient of the singleton in its row. */
+    double lb;                /**< Lower bound of the singleton. */
+    double ub;                /**< Upper bound of the singleton. */
+    double obj;               /**< Objective coefficient of the singleton. */
+    double val;               /**< Current value of the singleton (written back to x by store_singletons). */
+    int col;                  /**< Column index of the singleton. */
+} SINGLETON;
+
+/**
+ * @brief Sparse set of column indices, with constant time insertion, removal and membership test.
+ */
+typedef struct {
+    int* dense;               /**< Column indices in the set (first size entries, in no particular order). */
+    int* pos;                 /**< Position of each column in dense (-1 if not in the set). */
+    int size;                 /**< Current number of columns in the set. */
+} SPARSE_SET;
+
+/**
+ * @brief Rounding states of several LP points of the same instance, stored interleaved
+ *        (the K values of a variable or of a row are contiguous), so that a single scan
+ *        of a column updates all the states.
+ */
+typedef struct {
+    int size;                 /**< Number of states K (LP points). */
+    double* x;                /**< Solutions, interleaved: x[j * K + s]. */
+    double* slack;            /**< Row slacks, interleaved: slack[i * K + s]. */
+    double* ss_val;           /**< Singletons slacks, interleaved (NULL if singletons disabled). */
+    double* ss_start;         /**< Singletons slacks of the LP points, interleaved (NULL if singletons disabled). */
+    double* objval;           /**< Objective values (the moves of the singletons are added when materializing a state). */
+    double* solfrac;          /**< Solution fractionalities. */
+    int* numrounds;           /**< Number of rounds performed by each state. */
+    int* zerofrac_round;      /**< Round at the end of which each state reached zero fractionality (0 = never). */
+    int* active;              /**< Flags of the states that still need to be scanned. */
+} BATCH;
+
+/**
+ * @brief Sliced ELLPACK copy (SELL-C-sigma) of a set of columns: the columns, sorted by length within
+ *        windows of SELL_SIGMA columns, are grouped in chunks of SELL_C and each chunk is stored
+ *        nonzero-major and padded to its longest column, so that the k-th nonzeros of the SELL_C
+ *        columns are contiguous and the ratio test runs on all of them in lockstep.
+ */
+typedef struct {
+    int num_chunks;           /**< Number of chunks. */
+    int* col;                 /**< Column in each slot: col[c * SELL_C + lane] (-1 for the padding of the last chunk). */
+    int* len;                 /**< Length of the longest column of each chunk. */
+    nzind_t* beg;             /**< Begin index of each chunk in ind and val (num_chunks + 1 entries). */
+    int* ind;                 /**< Row indices: ind[beg[c] + k * SELL_C + lane] (nrows for the padding). */
+    double* val;              /**< Coefficients, same layout as ind (1.0 for the padding). */
+    double* room_up;          /**< Room of each row for an increase of its activity (nrows + 1 entries, the last one for the padding, allocated for each evaluation). */
+    double* room_down;        /**< Room of each row for a decrease of its activity (nrows + 1 entries). */
+    char* exact;              /**< Flags of the rows with exact integer slacks, evaluated by the scalar ratio test (nrows + 1 entries). */
+} SELL;
+
+/**
+ * @brief Working copy of the problem reduced by the presolve: matrix by columns and by rows
+ *        (the removed columns and rows are only flagged), bounds and right hand sides.
+ */
+typedef struct {
+    int ncols;                /**< Number of columns. */
+    int nrows;                /**< Number of rows. */
+    nzind_t* cbeg;            /**< Begin index of each column in cind and cval (ncols + 1 entries). */
+    int* cind;                /**< Row indices of the matrix by columns. */
+    double* cval;             /**< Coefficients of the matrix by columns. */
+    nzind_t* rbeg;            /**< Begin index of each row in rind and rval (nrows + 1 entries). */
+    int* rind;                /**< Column indices of the matrix by rows (in increasing order within each row). */
+    double* rval;             /**< Coefficients of the matrix by rows. */
+    double* lb;               /**< Lower bounds of the columns. */
+    double* ub;               /**< Upper bounds of the columns. */
+    double* obj;              /**< Objective coefficients of the columns. */
+    char* ctype;              /**< Variable types of the columns. */
+    double* rhs;              /**< Right hand sides of the rows (the fixed columns moved to the right hand side). */
+    char* sense;              /**< Senses of the rows. */
+    int* coldel;              /**< Flags of the removed columns (then new index of each column, -1 if removed). */
+    int* rowdel;              /**< Flags of the removed rows. */
+    int* rowlen;              /**< Number of nonzeros of each row on the columns not removed. */
+    int tightened;            /**< Number of bounds tightened. */
+} PRE_PROBLEM;
+
+/**
+ * @brief Map of the presolved problem back to the original one, used by the postsolve.
+ */
+typedef struct {
+    CPXLPptr orig_lp;         /**< Copy of the original problem (NULL if the problem was not reduced). */
+    int ncols;                /**< Number of columns of the original problem. */
+    int nrows;                /**< Number of rows of the original problem. */
+    int* colmap;              /**< Column of the presolved problem of each original column (-1 if removed). */
+    double* fixval;           /**< Value of each removed column. */
+    double obj_offset;        /**< Objective contribution of the removed columns. */
+    double* x;                /**< Rounded solution lifted to the original columns (set by postsolve). */
+} PRESOLVE;
+
 /**
  * @brief Structure holding local and global information about a
  * 	      problem instance, parameters included.
@@ -63,32 +307,51 @@ typedef struct {
     double* obj;              /**< Objective function coefficients. */
     double* lb;               /**< Variable lower bounds. */
     double* ub;               /**< Variable upper bounds. */
-    double* slack;            /**< Row (constraint) slacks, defined as right hand side minus row activity. */
+    ROW_STATE* rows;          /**< Hot row records: row (constraint) slacks, defined as right hand side minus row activity, senses and singletons slacks rooms. */
     double objval;            /**< Current objective value (for current problem solution). */
+    double objval_comp;       /**< Compensation of the incremental objective value during the rounding (see neumaier_add). */
     int objsen;               /**< Objective function sense, CPX_MIN (default) or CPX_MAX (specified from command line). */
     char* vartype;            /**< Variable types (before converting MIP to LP), integer/binary or continuous. */
     int* int_var;             /**< Flags array that keeps track of integer/binary (value 1) and continuous (value 0) variables. */
     int num_int_vars;         /**< Number of integer/binary variables to round. */
     double solfrac;           /**< Solution fractionality. */
+    double solfrac_comp;      /**< Compensation of the incremental solution fractionality during the rounding (see neumaier_add). */
+    int* movable;             /**< Indices of the integer columns that ZI-Round can shift (in index order). */
+    int num_movable;          /**< Number of movable integer columns. */
+    double* batch_x;          /**< LP points of the batched rounding (point-major, batch_size x ncols, the first one is x), NULL if OFF. */
+    int* perm;                /**< Column visit order of ZI-Round (random permutation of a multi-start run, NULL = index order). */
 
     // Singletons
     int* row_singletons;      /**< Singleton indices. */
     int rs_size;              /**< Total number of singletons. */
     int* rs_beg;              /**< Begin index of the singleton indices of each row that contains at least one. */
     double* rs_coef;          /**< Coefficients of the singletons. */
+    SINGLETON* rs_rec;        /**< Packed records of the singletons (same order of row_singletons), used by the rounding. */
     int* num_singletons;      /**< Number of singletons for each row. */
     double* ss_val;           /**< Singleton slack values for each row. */
     double* ss_ub;            /**< Upper bounds of the singletons slack for each row. */
     double* ss_lb;            /**< Lower bounds of the singletons slack for each row. */
+    int* rs_skip_inc;         /**< Offset of the first singleton of each row that can still increase its singletons slack (the ones before are saturated). */
+    int* rs_skip_dec;         /**< Offset of the first singleton of each row that can still decrease its singletons slack (the ones before are saturated). */
+
+    // Integral rows (allocated only during the rounding)
+    long long* int_act;       /**< Exact activity of each integral row over its columns at an integer value. */
+    int* num_nonint;          /**< Number of columns of each integral row not at an integer value (exact slack iff zero). */
+    char* x_int;              /**< Flag set to 1 iff the column is exactly at an integer value. */
 
     // Constraints
-    int nzcnt;                /**< Number of non-zero coefficients. */
-    int* rmatbeg;             /**< Begin row indices of non-zero coefficients for rmatind and rmatval. */
+    nzind_t nzcnt;            /**< Number of non-zero coefficients. */
+    nzind_t* rmatbeg;         /**< Begin row indices of non-zero coefficients for rmatind and rmatval (nrows + 1 entries, rmatbeg[nrows] = nzcnt). */
     int* rmatind;             /**< Column indices of non-zero coefficients. */
     double* rmatval;          /**< Non-zero coefficients (row major). */
-    int* cmatbeg;             /**< Begin column indices of non-zero coefficients for cmatind and cmatval. */
+    nzind_t* cmatbeg;         /**< Begin column indices of non-zero coefficients for cmatind and cmatval (ncols + 1 entries, cmatbeg[ncols] = nzcnt). */
     int* cmatind;             /**< Row indices of non-zero coefficients. */
-    double* cmatval;          /**< Non-zero coefficients (column major). */
+    double* cmatval;          /**< Non-zero coefficients (column major, NULL if coded in the compressed columns). */
+    unsigned char* cmatcode;  /**< Compressed columns: zigzag varint row index deltas, each followed by the coefficient code if the dictionary is used (NULL if not compressed). */
+    size_t* cmatpos;          /**< Begin byte of each compressed column in cmatcode (ncols + 1 entries). */
+    double* cmatdict;         /**< Dictionary of the distinct coefficients of the compressed columns (NULL if not used). */
+    int dictsize;             /**< Number of coefficients of the dictionary. */
+    float* cmatflt;           /**< Non-zero coefficients in single precision, all exact (column major, NULL if not used). */
     char* sense;              /**< Constraint (row) senses, 'L' (<=) or 'G' (>=) or 'E' (=). */
     double* rhs;              /**< Constraint right hand sides (rhs). */
 
@@ -111,14 +374,136 @@ typedef struct {
     int singletons;           /**< Flag for the use of singletons in ZI-Round (default 1 = ON). */
     int shift_nonfracvars;    /**< Flag for shifting also non-fractional integer variables in ZI-Round (default 1 = ON). */
     int sort_singletons;      /**< Flag for sorting the singletons of each row in ascending order of objective coefficients (default 0 = OFF). */
+    int multi_shift;          /**< Flag for shifting non-fractional integer variables by the largest integral amount instead of exactly one unit (default 1 = ON). */
     int after0frac;           /**< Flag for activating the shifting of non-fractional integer varables only when fractionality reaches zero (default 0 = OFF). */
     int max_rounds;           /**< Flag for controlling the maximum number of rounds (scans of the variables) performed by ZI-Round (default 0 = OFF). */
     int fractie_worstobj;     /**< Flag for activating the shifting of non-fractional integer variables to worsen the objective when there are ties on the fractionality improvement (default 0 = OFF). */
     int timelimit;            /**< Time limit in seconds. */
     int rseed;                /**< Random seed. */
+    int stall_rounds;         /**< Number of consecutive stalled rounds that trigger the stall action (default 0 = OFF). */
+    double stall_frac;        /**< Minimum decrease of the solution fractionality for a round not to be considered stalled. */
+    double stall_obj;         /**< Minimum relative improvement of the objective value for a round not to be considered stalled. */
+    int stall_action;         /**< Action taken on stall: 0 = monitor only, 1 = stop, 2 = switch to fractional shifts only, then stop (default 1). */
+    double eps_start;         /**< Threshold of the fractional shifts in the first round, tightened every round down to EPSILON (default EPSILON = OFF). */
+    double eps_decay;         /**< Factor applied to the threshold of the fractional shifts after each round (default 0.1). */
+    int one_opt;              /**< Flag for shifting non-fractional integer variables in a separate 1-opt phase after the rounding (default 0 = OFF). */
+    int batch_size;           /**< Number of LP points (solved with different random seeds) rounded in lockstep by the batched rounding (default 0 = OFF). */
+    int num_starts;           /**< Number of randomized column orders run in parallel from the same LP solution (default 0 = OFF). */
+    int lazy_singletons;      /**< Flag for updating only the aggregated singletons slacks during the rounding, and the singletons at the end (default 0 = OFF). */
+    int presolve;             /**< Flag for the built-in presolve of the problem before the LP solve, with postsolve of the rounded solution (default 0 = OFF). */
+    PRESOLVE pre;             /**< Map of the presolved problem back to the original one (used iff presolve is set). */
+    int components;           /**< Flag for rounding the connected components of the row/column graph independently, in parallel (default 0 = OFF). */
+    int is_part;              /**< Flag of a view of the instance restricted to some of its connected components (set by component_round only). */
+    double* part_delta_up;    /**< Maximum up-shifts shared by the parts of the component rounding (each part writes only its own columns). */
+    double* part_delta_down;  /**< Maximum down-shifts shared by the parts of the component rounding. */
+    SELL sell;                /**< Sliced ELLPACK copy of the columns that can be 1-opt candidates (built at load time iff sell_oneopt is set). */
+    int sell_oneopt;          /**< Flag for evaluating the 1-opt candidates in bulk on a sliced ELLPACK (SELL-C-sigma) copy of their columns (default 0 = OFF). */
+    int rcm;                  /**< Flag for renumbering the rows in reverse Cuthill-McKee order before the rounding (default 0 = OFF). */
+    int* row_orig;            /**< Original index of each row (NULL if the rows were not renumbered). */
+    int resync_rounds;        /**< Number of rounds between two recomputations from scratch of objective, fractionality and row slacks (default 0 = never). */
+    int int_rows;             /**< Flag for the exact integer slacks of the integral rows (default 0 = OFF). */
+    int csc_only;             /**< Flag for storing the constraint matrix only by columns, building the row view only when needed (default 0 = OFF). */
+    int mixed_precision;      /**< Flag for storing the coefficients in single precision, if exact (default 0 = OFF). */
+    int compress_csc;         /**< Flag for compressing the row indices (and coefficients, if few distinct) of the matrix by columns (default 0 = OFF). */
+    int mmap_store;           /**< Flag for keeping the matrix by columns and the immutable column data in a memory-mapped file (default 0 = OFF). */
+    STORE store;              /**< Memory-mapped store of the column data (used iff mmap_store is set). */
+    int col_order;            /**< Visit order of the fractional columns in each round: 0 = index order, 1 = closest to an integer first, 2 = largest fractionality reduction per unit of slack consumed first (default 0). */
+
+    // Statistics
+    int stall_round;          /**< Round at which the stall rule fired first (0 = never). */
+    int stall_saved;          /**< Rounds performed after the stall rule fired (monitor mode only), i.e. rounds a stop would have saved. */
+    int oneopt_shifts;        /**< Number of shifts applied by the 1-opt phase. */
+    int oneopt_evals;         /**< Number of column evaluations performed by the 1-opt phase. */
+    int zerofrac_round;       /**< Round at the end of which the solution fractionality reached zero (0 = never). */
+    int batch_best;           /**< Index of the best LP point of the batched rounding (0 = LP solution of the instance). */
+    int ms_best;              /**< Index of the best start of a multi-start run (0 = index order). */
+    int ms_feasible;          /**< Number of starts of a multi-start run that reached zero fractionality. */
+    int num_comps;            /**< Number of connected components with movable columns found by the component rounding. */
 
 } INSTANCE;
 
+// COLUMN ITERATOR -------------------------------------------------------------------------------------
+
+/**
+ * @brief Original index (as read from CPLEX) of a row, for the messages.
+ *
+ * @param inst Pointer to the instance.
+ * @param i Row index.
+ * @return Index of the row before the renumbering (if any).
+ */
+static __inline int orig_row(const INSTANCE* inst, int i) {
+    return (inst->row_orig != NULL) ? inst->row_orig[i] : i;
+}
+
+/**
+ * @brief Start the iteration over the nonzeros of column \p j.
+ *
+ * @param inst Pointer to the instance.
+ * @param j Column index.
+ * @param it Iterator to initialize.
+ */
+static __inline void col_begin(const INSTANCE* inst, int j, COL_ITER* it) {
+
+    it->k = inst->cmatbeg[j];
+    it->end = inst->cmatbeg[j + 1];
+    it->ind = inst->cmatind;
+    it->val = inst->cmatval;
+    it->flt = inst->cmatflt;
+    it->dict = inst->cmatdict;
+    it->code = (inst->cmatcode != NULL) ? inst->cmatcode + inst->cmatpos[j] : NULL;
+    it->plain = (it->code == NULL) && (it->val != NULL);
+    it->rowind = 0;
+}
+
+/**
+ * @brief Next nonzero of a compressed or single precision column (see col_next).
+ *
+ * @param it Iterator of the column.
+ * @param rowind Row index of the nonzero.
+ * @param aij Coefficient of the nonzero.
+ */
+static __inline void col_next_packed(COL_ITER* it, int* rowind, double* aij) {
+
+    unsigned int z;
+    int shift;
+
+    if (it->code == NULL) *rowind = it->ind[it->k];
+    else {
+        z = 0; shift = 0;
+        do { z |= (unsigned int)(*(it->code) & 0x7F) << shift; shift += 7; } while (*(it->code++) & 0x80);
+        it->rowind += (int)(z >> 1) ^ -(int)(z & 1);
+        *rowind = it->rowind;
+    }
+    if (it->val != NULL) *aij = it->val[it->k];
+    else if (it->flt != NULL) *aij = (double)(it->flt[it->k]);
+    else *aij = it->dict[*(it->code++)];
+    it->k++;
+}
+
+/**
+ * @brief Next nonzero of the column, decoded in place if the columns are compressed.
+ *        Besides the end test, plain columns only branch on a flag fixed for the whole column.
+ *
+ * @param it Iterator of the column.
+ * @param rowind Row index of the nonzero.
+ * @param aij Coefficient of the nonzero.
+ * @return 1 if a nonzero was read, 0 at the end of the column.
+ */
+static __inline int col_next(COL_ITER* it, int* rowind, double* aij) {
+
+    if (it->k >= it->end) return 0;
+
+    if (it->plain) {
+        *rowind = it->ind[it->k];
+        *aij = it->val[it->k];
+        it->k++;
+    }
+    else col_next_packed(it, rowind, aij);
+
+    return 1;
+}
+// -----------------------------------------------------------------------------------------------------
+
 // MAIN.C ----------------------------------------------------------------------------------------------
 
 /**
@@ -159,6 +544,31 @@ void init_inst(INSTANCE* inst);
  * @param inst Pointer to the already populated instance.
  */
 void free_inst(INSTANCE* inst);
+
+/**
+ * @brief Clone an instance sharing its problem data, with private copies of the
+ *        rounding state (solution, row slacks, singletons slacks, skip pointers and singleton records).
+ *
+ * @param clone Pointer to the clone to populate.
+ * @param inst Pointer to the already populated instance.
+ */
+void clone_inst(INSTANCE* clone, INSTANCE* inst);
+
+/**
+ * @brief Copy the rounding state and the statistics of a clone back into its instance
+ *        (the trackers are moved).
+ *
+ * @param inst Pointer to the instance.
+ * @param clone Pointer to the clone of the instance.
+ */
+void copy_inst_state(INSTANCE* inst, INSTANCE* clone);
+
+/**
+ * @brief Deallocate the private fields of a clone (the shared problem data is untouched).
+ *
+ * @param clone Pointer to the clone.
+ */
+void free_clone(INSTANCE* clone);
 // -----------------------------------------------------------------------------------------------------
 
 // CMD_INTERFACE.C -------------------------------------------------------------------------------------
@@ -208,6 +618,14 @@ void save_integer_variables(INSTANCE* inst);
  * @param inst Pointer to the already populated instance.
  */
 void solve_continuous_relaxation(INSTANCE* inst);
+
+/**
+ * @brief Solve the continuous relaxation again from scratch with different random seeds, and save
+ *        the LP points for the batched rounding (the first one is the current LP solution).
+ *
+ * @param inst Pointer to the already populated instance.
+ */
+void solve_batch_relaxations(INSTANCE* inst);
 // -----------------------------------------------------------------------------------------------------
 
 // READ_ZIROUND_INPUT.C --------------------------------------------------------------------------------
@@ -287,6 +705,15 @@ void read_constraints_right_hand_sides(INSTANCE* inst);
  */
 void read_row_slacks(INSTANCE* inst);
 
+/**
+ * @brief Build the row view of the constraint matrix (rmatbeg, rmatind, rmatval) by transposing
+ *        the column view in O(nnz), with chunks of columns in parallel. Does nothing if the row view
+ *        is already available (it is read from CPLEX unless the CSC-only mode is enabled).
+ *
+ * @param inst Pointer to the already populated instance.
+ */
+void build_row_view(INSTANCE* inst);
+
 /**
  * @brief Find singletons of the problem, i.e. continuous variables that
  * appear in only one constraint, and populate the corresponding data structures.
@@ -304,7 +731,8 @@ void find_singletons(INSTANCE* inst);
 void compute_singletons_slacks(INSTANCE* inst);
 
 /**
- * @brief Sort singleton indices and coefficients of a single row by lowest objective function coefficient.
+ * @brief Sort singleton indices and coefficients of a single row by lowest objective function coefficient
+ *        (ties broken by column index), in O(k log k) time.
  *
  * @details The row is represented by a \p start and \p end index of the arrays \p rs_ind and \p rs_coef.
  *
@@ -315,6 +743,32 @@ void compute_singletons_slacks(INSTANCE* inst);
  * @param obj Objective function coefficients.
  */
 void sort_singletons(int start, int end, int* rs_ind, double* rs_coef, double* obj);
+
+/**
+ * @brief Compare two singleton sort keys (for qsort, ascending objective coefficient, then column index).
+ *
+ * @param a Pointer to the first key.
+ * @param b Pointer to the second key.
+ * @return Negative, zero or positive if the first key is less, equal or greater than the second one.
+ */
+int compare_singleton_keys(const void* a, const void* b);
+
+/**
+ * @brief Find the integer columns that ZI-Round can actually shift, i.e. the non-fixed
+ *        integer/binary variables that do not appear in any equality constraint with no singletons.
+ *
+ * @param inst Pointer to the already populated instance.
+ */
+void find_movable_columns(INSTANCE* inst);
+
+/**
+ * @brief Find the integral rows: integer coefficients and right hand side, only integer columns with
+ *        finite bounds, no singletons, and activities that fit INT_ROW_MAX. Once all their columns are at
+ *        integer values, their slacks are kept exact (see load_integral_rows).
+ *
+ * @param inst Pointer to the already populated instance.
+ */
+void find_integral_rows(INSTANCE* inst);
 // -----------------------------------------------------------------------------------------------------
 
 // ZIROUND.C -------------------------------------------------------------------------------------------
@@ -329,6 +783,15 @@ void sort_singletons(int start, int end, int* rs_ind, double* rs_coef, double* o
  */
 void zi_round(INSTANCE* inst, int* numrounds);
 
+/**
+ * @brief Final steps of the rounding on the whole instance: 1-opt phase, lazy singletons,
+ *        singletons values, integral rows and compensation terms.
+ *
+ * @param inst Pointer to the instance.
+ * @param num_toround Number of variables to round (printed only).
+ */
+void end_rounding(INSTANCE* inst, int num_toround);
+
 /**
  * @brief Check whether all constraints affected by a round up/down of xj have enough slack for it.
  *
@@ -373,7 +836,7 @@ int round_xj_bestobj(INSTANCE* inst, int j, double objcoef, double delta_up, dou
 int round_xj_worstobj(INSTANCE* inst, int j, double objcoef, double delta_up, double delta_down, int xj_fractional, double* solfrac, int* num_toround);
 
 /**
- * @brief Update the slack array field of the instance (incrementally)
+ * @brief Update the row slacks of the instance (incrementally)
  *        after a rounding of the current solution (x) field of the instance.
  *
  * @details Whenever it is called, only one variable xj has been updated.
@@ -394,122 +857,849 @@ void update_slacks(INSTANCE* inst, int j, double signed_delta);
 void update_singletons(INSTANCE* inst, int rowind, double delta_ss);
 
 /**
- * @brief Compute the j-th entries of the arrays of possible up-shifts and down-shifts
- *        according to the ZI-Round heuristic specifications.
+ * @brief Check whether a singleton is at the bound that stops it from moving the singletons
+ *        slack of its row in a given direction.
  *
- * @param inst Pointer to the already populated instance.
- * @param j Variable index.
- * @param delta_up Array of possible up-shifts.
- * @param delta_down Array of possible down-shifts.
- * @param epsilon Tolerance for the computed up/down shifts.
+ * @param inst Pointer to the instance.
+ * @param k Absolute index of the singleton (in row_singletons, rs_coef and rs_rec).
+ * @param s_slack_increase Flag set to 1 for the increase of the singletons slack, 0 for the decrease.
+ * @return 1 if the singleton is saturated in the given direction, 0 otherwise.
  */
-void delta_updown(INSTANCE* inst, int j, double* delta_up, double* delta_down, const double epsilon);
+int singleton_saturated(INSTANCE* inst, int k, int s_slack_increase);
 
 /**
- * @brief Compute singletons slack of a given constraint (row).
+ * @brief Reset the skip pointers of the singletons of all the rows (needed whenever the singleton
+ *        values are changed outside update_singletons).
  *
  * @param inst Pointer to the instance.
- * @param rowind Index of the constraint.
- * @return Singletons slack of the constraint.
  */
-double compute_ss_val(INSTANCE* inst, int rowind);
-// -----------------------------------------------------------------------------------------------------
+void reset_singletons_skips(INSTANCE* inst);
 
-// UTIL.C ----------------------------------------------------------------------------------------------
+/**
+ * @brief Copy the current solution values of the singletons into their packed records
+ *        (needed whenever x is changed outside the rounding).
+ *
+ * @param inst Pointer to the instance.
+ */
+void load_singletons(INSTANCE* inst);
 
 /**
- * @brief Check that all the variable bounds are satisfied, for the given solution \p x.
+ * @brief Write the values of the packed singleton records back to the solution (x).
  *
- * @param x Solution to be used for evaluating bounds satisfiability.
- * @param lb Lower bounds of the variables.
- * @param ub Upper bounds of the variables.
- * @param ncols Number of variables.
+ * @param inst Pointer to the instance.
  */
-void check_bounds(double* x, double* lb, double* ub, int ncols);
+void store_singletons(INSTANCE* inst);
 
 /**
- * @brief Check whether all the constraints are satisfied, for the given solution \p x.
+ * @brief Initialize the exact activities of the integral rows from the current solution (if enabled),
+ *        and set the slacks of the rows with all their columns at integer values to their exact value.
  *
- * @param x Solution to be used for evaluating constraints satisfiability.
- * @param ncols Number of variables.
- * @param nrows Number of constraints.
- * @param nzcnt Number of non-zero coefficients in the constraints.
- * @param rmatbeg Constraints begin indices structure.
- * @param rmatind Constraints column indices structure.
- * @param rmatval Constraint coefficients.
- * @param sense Constraint senses.
- * @param rhs Constraint right hand sides.
+ * @param inst Pointer to the instance.
  */
-void check_constraints(double* x, int ncols, int nrows, int nzcnt, int* rmatbeg, int* rmatind, double* rmatval, char* sense, double* rhs);
+void load_integral_rows(INSTANCE* inst);
 
 /**
- * @brief Check whether all the integer variables of the original MIP have been rounded.
+ * @brief Free the exact activities of the integral rows.
  *
- * @param x Current solution.
- * @param ncols Number of variables.
- * @param int_var Array of flags for binary/integer variables in the original MIP.
- * @param vartype Array of variable types.
- * @return 1 iff all integer/binary variables have been rounded, 0 otherwise.
+ * @param inst Pointer to the instance.
  */
-int check_rounding(double* x, int ncols, int* int_var, char* vartype);
+void free_integral_rows(INSTANCE* inst);
 
 /**
- * @brief Count number of variables rounded so far.
+ * @brief Update the exact activity of an integral row after a shift of one of its columns,
+ *        and set its slack to the exact value if all its columns are at integer values.
  *
- * @param x Current solution.
- * @param ncols Number of variables.
- * @param int_var Array of flags for binary/integer variables in the original MIP.
- * @param vartype Array of variable types.
- * @return Number of variables rounded so far.
+ * @param inst Pointer to the instance.
+ * @param rowind Index of the integral row.
+ * @param aij Coefficient of the shifted column in the row.
+ * @param xold Previous value of the column (used iff integer).
+ * @param xnew Current value of the column (used iff integer).
+ * @param old_int Flag set to 1 iff the previous value is integer.
+ * @param new_int Flag set to 1 iff the current value is integer.
  */
-int count_rounded(double* x, int ncols, int* int_var, char* vartype);
+void update_integral_row(INSTANCE* inst, int rowind, double aij, double xold, double xnew, int old_int, int new_int);
 
 /**
- * @brief Calculate the fractionality of the given value.
+ * @brief Ratio test of an integral row with all its columns at integer values (exact slack): the
+ *        largest integral shift allowed by the row, by floor division, without tolerance checks.
  *
- * @param xj Value.
- * @return Fractionality of the value.
+ * @param sense Constraint sense ('L' or 'G').
+ * @param slack Exact row slack.
+ * @param aij Coefficient of the column in the row (integer, non-zero).
+ * @param delta_up1 Up-shift candidate (updated if the row limits the up-shifts).
+ * @param delta_down1 Down-shift candidate (updated if the row limits the down-shifts).
  */
-double fractionality(double xj);
+void integral_ratio(char sense, double slack, double aij, double* delta_up1, double* delta_down1);
 
 /**
- * @brief Calculate the fractionality of a solution.
+ * @brief Recompute from scratch (in parallel) the objective value, the solution fractionality and the
+ *        slacks of the inequality rows without singletons, discarding the drift of the incremental updates.
  *
- * @param x Solution.
- * @param int_var Flags array for integer variables.
- * @param len Length of the array.
- * @return Fractionality of the solution.
+ * @param inst Pointer to the instance (during the rounding).
  */
-double sol_fractionality(double* x, int* int_var, int len);
+void resync_state(INSTANCE* inst);
 
 /**
- * @brief Check the integrality of the given value.
+ * @brief Compute the j-th entries of the arrays of possible up-shifts and down-shifts
+ *        according to the ZI-Round heuristic specifications.
  *
- * @param num Value.
- * @return 1 if the value is fractional, 0 otherwise.
+ * @param inst Pointer to the already populated instance.
+ * @param j Variable index.
+ * @param delta_up Array of possible up-shifts.
+ * @param delta_down Array of possible down-shifts.
+ * @param epsilon Tolerance for the computed up/down shifts.
  */
-int is_fractional(double num);
+void delta_updown(INSTANCE* inst, int j, double* delta_up, double* delta_down, const double epsilon);
 
 /**
- * @brief Calculate the dot product of two arrays (of the same length).
+ * @brief Compute the j-th entries of the arrays of possible up-shifts and down-shifts
+ *        of a non-fractional integer variable, keeping only integral shifts (the largest
+ *        integral ones if multi-unit shifts are enabled, exactly one unit otherwise).
  *
- * @param coef First array.
- * @param var_value Second array.
- * @param len Length of both arrays.
- * @return Dot product of the two arrays.
+ * @param inst Pointer to the already populated instance.
+ * @param j Variable index.
+ * @param delta_up Array of possible up-shifts.
+ * @param delta_down Array of possible down-shifts.
  */
-double dot_product(double* coef, double* var_value, int len);
+void integral_deltas(INSTANCE* inst, int j, double* delta_up, double* delta_down);
 
 /**
- * @brief Free memory allocated to multiple pointers.
+ * @brief Reduce the j-th entries of the arrays of possible shifts (computed with epsilon = 1.0)
+ *        to integral shifts (the largest integral ones if multi-unit shifts are enabled, exactly
+ *        one unit otherwise).
  *
- * @details It does not check the type of the passed ellipsis parameters, so
- * be sure that actual pointers are passed. Use with care.
+ * @param inst Pointer to the already populated instance.
+ * @param j Variable index.
+ * @param delta_up Array of possible up-shifts.
+ * @param delta_down Array of possible down-shifts.
+ */
+void integral_shifts(INSTANCE* inst, int j, double* delta_up, double* delta_down);
+
+/**
+ * @brief Compute the column visit order of a round: the fractional columns in decreasing
+ *        order of priority (according to the column order parameter of the instance),
+ *        followed by all the other columns in the visit order of the instance (index order
+ *        or its permutation).
  *
- * @param count The number of pointers.
- * @param ... The actual pointers.
+ * @param inst Pointer to the already populated instance.
+ * @param order Array of column indices to fill (ncols entries).
+ * @param pushed Support flags array (ncols entries).
+ * @param heap Pointer to an already initialized heap (emptied on return).
+ * @param delta_up Array of possible up-shifts.
+ * @param delta_down Array of possible down-shifts.
+ * @param epsilon Threshold of the fractional shifts in the current round.
  */
-void free_all(int count, ...);
+void priority_order(INSTANCE* inst, int* order, int* pushed, HEAP* heap, double* delta_up, double* delta_down, const double epsilon);
+
+/**
+ * @brief Compute singletons slack of a given constraint (row).
+ *
+ * @param inst Pointer to the instance.
+ * @param rowind Index of the constraint.
+ * @return Singletons slack of the constraint.
+ */
+double compute_ss_val(INSTANCE* inst, int rowind);
+
+/**
+ * @brief Update only the aggregated singletons slack of the constraint \p rowind (lazy singletons):
+ *        the singleton values and the objective are updated later by materialize_singletons.
+ *
+ * @param inst Pointer to the instance.
+ * @param rowind Index of the constraint.
+ * @param delta_ss Delta singletons slack.
+ */
+void lazy_update_singletons(INSTANCE* inst, int rowind, double delta_ss);
+
+/**
+ * @brief Move the singletons of each row so that they match its aggregated singletons slack,
+ *        with the same fill order of update_singletons (also updates the objective value).
+ *
+ * @param inst Pointer to the instance.
+ */
+void materialize_singletons(INSTANCE* inst);
+
+/**
+ * @brief Refresh the singletons slack rooms of the record of row \p rowind after a change of its singletons slack.
+ *
+ * @param inst Pointer to the instance.
+ * @param rowind Index of the constraint.
+ */
+void refresh_row_singletons(INSTANCE* inst, int rowind);
+// -----------------------------------------------------------------------------------------------------
+
+// BATCH.C ---------------------------------------------------------------------------------------------
+
+/**
+ * @brief Round all the LP points of the instance in lockstep (same rules of ZI-Round, singletons
+ *        handled through their aggregated slack), and keep the best rounding: the least
+ *        fractional one, then the one with the best objective.
+ *
+ * @param inst Pointer to the already populated instance (with its LP points).
+ * @param numrounds Pointer to the number of rounds performed by the best LP point.
+ */
+void batch_round(INSTANCE* inst, int* numrounds);
+
+/**
+ * @brief Allocate the batch and interleave the states of the LP points of the instance.
+ *
+ * @param inst Pointer to the already populated instance (with its LP points).
+ * @param batch Pointer to the batch.
+ */
+void batch_init(INSTANCE* inst, BATCH* batch);
+
+/**
+ * @brief Compute the maximum up-shifts and down-shifts of variable \p j in all the states,
+ *        with a single scan of its column (no threshold applied).
+ *
+ * @param inst Pointer to the already populated instance.
+ * @param batch Pointer to the batch.
+ * @param j Variable index.
+ * @param delta_up Maximum up-shifts (one per state).
+ * @param delta_down Maximum down-shifts (one per state).
+ */
+void batch_deltas(INSTANCE* inst, BATCH* batch, int j, double* delta_up, double* delta_down);
+
+/**
+ * @brief Choose the shift of variable \p j in state \p s, following the rules of ZI-Round.
+ *
+ * @param inst Pointer to the already populated instance.
+ * @param batch Pointer to the batch.
+ * @param j Variable index.
+ * @param s State index.
+ * @param delta_up Maximum up-shift of variable \p j in state \p s.
+ * @param delta_down Maximum down-shift of variable \p j in state \p s.
+ * @param epsilon Threshold of the fractional shifts in the current round.
+ * @return Signed shift of variable \p j (0 if none).
+ */
+double batch_shift(INSTANCE* inst, BATCH* batch, int j, int s, double delta_up, double delta_down, const double epsilon);
+
+/**
+ * @brief Choose between \p delta_up and \p delta_down by objective, with the same cases
+ *        of round_xj_bestobj (or round_xj_worstobj).
+ *
+ * @param objsen Objective function sense.
+ * @param objcoef Objective coefficient of the variable.
+ * @param delta_up Candidate up-shift.
+ * @param delta_down Candidate down-shift.
+ * @param worstobj Flag for worsening the objective instead of improving it.
+ * @return Signed shift (0 if none).
+ */
+double objective_shift(int objsen, double objcoef, double delta_up, double delta_down, int worstobj);
+
+/**
+ * @brief Update the row slacks and the singletons slacks of all the states after the shifts
+ *        of variable \p j, with a single scan of its column.
+ *
+ * @param inst Pointer to the already populated instance.
+ * @param batch Pointer to the batch.
+ * @param j Variable index.
+ * @param shift Signed shifts of variable \p j (one per state).
+ */
+void batch_update(INSTANCE* inst, BATCH* batch, int j, double* shift);
+
+/**
+ * @brief Copy state \p s into the instance, distributing the changes of the singletons slacks
+ *        among the singletons.
+ *
+ * @param inst Pointer to the already populated instance.
+ * @param batch Pointer to the batch.
+ * @param s State index.
+ */
+void batch_materialize(INSTANCE* inst, BATCH* batch, int s);
+
+/**
+ * @brief Deallocate the batch.
+ *
+ * @param batch Pointer to the batch.
+ */
+void batch_free(BATCH* batch);
+// -----------------------------------------------------------------------------------------------------
+
+// MULTISTART.C ----------------------------------------------------------------------------------------
+
+/**
+ * @brief Run ZI-Round from the same LP solution with several random column orders
+ *        in parallel (the first start keeps the index order), and keep the best rounding:
+ *        the least fractional one, then the one with the best objective.
+ *
+ * @param inst Pointer to the already populated instance.
+ * @param numrounds Pointer to the number of rounds performed by the best start.
+ */
+void multi_start(INSTANCE* inst, int* numrounds);
+// -----------------------------------------------------------------------------------------------------
+
+// COMPONENTS.C ----------------------------------------------------------------------------------------
+
+/**
+ * @brief Round the connected components of the row/column graph independently: the components
+ *        are grouped in at most COMPONENT_PARTS parts of similar size, and the parts are rounded
+ *        in parallel on the shared state (each one only touches its own columns and rows).
+ *        The 1-opt phase and the singletons are then completed on the whole instance.
+ *
+ * @param inst Pointer to the already populated instance.
+ * @param numrounds Pointer to the largest number of rounds performed by a part.
+ */
+void component_round(INSTANCE* inst, int* numrounds);
+
+/**
+ * @brief Find the connected components of the row/column graph (union-find over the matrix by columns).
+ *
+ * @param inst Pointer to the instance.
+ * @param comp Component of each column (numbered in the order of their first column).
+ * @return Number of components.
+ */
+int find_components(INSTANCE* inst, int* comp);
+
+/**
+ * @brief Find the root of a node of a union-find forest (with path halving).
+ *
+ * @param parent Parent of each node.
+ * @param v Node.
+ * @return Root of the node.
+ */
+int uf_find(int* parent, int v);
+
+/**
+ * @brief Compute the fractionality and the number of variables to round of a part of the component rounding.
+ *
+ * @param part Pointer to the view of the part.
+ * @param num_toround Pointer to the number of fractional movable columns of the part.
+ */
+void part_fractionality(INSTANCE* part, int* num_toround);
+// -----------------------------------------------------------------------------------------------------
+
+// PRESOLVE.C ------------------------------------------------------------------------------------------
+
+/**
+ * @brief Presolve the problem read from file, before the LP solve: remove the fixed columns, the empty,
+ *        singleton (turned into bounds), redundant and duplicate rows, and tighten the bounds of the
+ *        columns on the activity bounds of the rows (rounded for the integer columns).
+ *        The problem of the instance is reduced in place, the original one is kept for the postsolve.
+ *
+ * @param inst Pointer to the instance with the problem read from file.
+ */
+void presolve(INSTANCE* inst);
+
+/**
+ * @brief Lift the rounded solution to the original problem (the removed columns at their fixed value),
+ *        check it against the original bounds and constraints and add the objective offset.
+ *
+ * @param inst Pointer to the instance with the rounded solution.
+ */
+void postsolve(INSTANCE* inst);
+
+/**
+ * @brief Remove the fixed columns, moving their contribution to the right hand sides.
+ *
+ * @param inst Pointer to the instance.
+ * @param pp Pointer to the working copy of the problem.
+ * @return Number of columns removed.
+ */
+int presolve_fixed_columns(INSTANCE* inst, PRE_PROBLEM* pp);
+
+/**
+ * @brief Remove the empty, singleton and redundant rows, and tighten the bounds of the columns of the
+ *        other rows on their activity bounds.
+ *
+ * @param pp Pointer to the working copy of the problem.
+ * @return Number of rows removed plus number of bounds tightened.
+ */
+int presolve_rows(PRE_PROBLEM* pp);
+
+/**
+ * @brief Remove the rows with the same coefficients as another row of the same sense (keeping the tighter
+ *        right hand side).
+ *
+ * @param pp Pointer to the working copy of the problem.
+ * @return Number of rows removed.
+ */
+int presolve_duplicate_rows(PRE_PROBLEM* pp);
+
+/**
+ * @brief Tighten a bound of a column (rounded if the column is integer), if the gain is large enough.
+ *
+ * @param pp Pointer to the working copy of the problem.
+ * @param j Column index.
+ * @param lu Bound to tighten ('L' or 'U').
+ * @param value New bound.
+ * @param min_gain Minimum relative gain for a continuous column.
+ * @return 1 if the bound changed, 0 otherwise.
+ */
+int presolve_bound(PRE_PROBLEM* pp, int j, char lu, double value, double min_gain);
+
+/**
+ * @brief Check whether two rows have the same coefficients on the columns not removed.
+ *
+ * @param pp Pointer to the working copy of the problem.
+ * @param r1 First row index.
+ * @param r2 Second row index.
+ * @return 1 if the rows are identical, 0 otherwise.
+ */
+int same_row(PRE_PROBLEM* pp, int r1, int r2);
+
+/**
+ * @brief Deallocate the working copy of the problem.
+ *
+ * @param pp Pointer to the working copy of the problem.
+ */
+void free_pre_problem(PRE_PROBLEM* pp);
+// -----------------------------------------------------------------------------------------------------
+
+// SELL.C ----------------------------------------------------------------------------------------------
+
+/**
+ * @brief Build the sliced ELLPACK copy of the instance (if enabled, with the 1-opt phase) once at load time:
+ *        the integer columns not fixed and with a nonzero objective coefficient, i.e. all the possible
+ *        1-opt candidates whatever the rounded solution.
+ *
+ * @param inst Pointer to the instance (matrix by columns in its final layout).
+ */
+void load_sell(INSTANCE* inst);
+
+/**
+ * @brief Compute the gains of all the 1-opt candidates on the sliced ELLPACK copy of the instance
+ *        (same results as oneopt_gain for each candidate, the other entries are untouched).
+ *
+ * @param inst Pointer to the instance (row slacks already clipped to their sign).
+ * @param gain Array of gains (the entries of the candidates are updated).
+ * @param delta_up Array of possible up-shifts (the entries of the candidates are updated).
+ * @param delta_down Array of possible down-shifts (the entries of the candidates are updated).
+ */
+void sell_gains(INSTANCE* inst, double* gain, double* delta_up, double* delta_down);
+
+/**
+ * @brief Build the sliced ELLPACK copy of a set of columns (the rooms of the rows are not allocated).
+ *
+ * @param inst Pointer to the instance.
+ * @param sell Pointer to the sliced ELLPACK copy.
+ * @param cols Columns to copy.
+ * @param num_cols Number of columns to copy.
+ */
+void sell_build(INSTANCE* inst, SELL* sell, int* cols, int num_cols);
+
+/**
+ * @brief Compute the room of each row for an increase and a decrease of its activity, from its
+ *        slack and its singletons slack (same values used by delta_updown).
+ *
+ * @param inst Pointer to the instance.
+ * @param sell Pointer to the sliced ELLPACK copy.
+ */
+void sell_rooms(INSTANCE* inst, SELL* sell);
+
+/**
+ * @brief Compute the integral shifts of the columns of a chunk, running the ratio test on all
+ *        of them in lockstep (columns with an exact integral row fall back to integral_deltas).
+ *
+ * @param inst Pointer to the instance.
+ * @param sell Pointer to the sliced ELLPACK copy (rooms already computed).
+ * @param c Chunk index.
+ * @param delta_up Array of possible up-shifts (the entries of the columns of the chunk are updated).
+ * @param delta_down Array of possible down-shifts (the entries of the columns of the chunk are updated).
+ */
+void sell_deltas(INSTANCE* inst, SELL* sell, int c, double* delta_up, double* delta_down);
+
+/**
+ * @brief Deallocate the sliced ELLPACK copy.
+ *
+ * @param sell Pointer to the sliced ELLPACK copy.
+ */
+void sell_free(SELL* sell);
+// -----------------------------------------------------------------------------------------------------
+
+// REORDER.C -------------------------------------------------------------------------------------------
+
+/**
+ * @brief Renumber the rows (if enabled) in reverse Cuthill-McKee order of the row intersection graph,
+ *        so that the rows of each column, and their slacks, are close in memory. The columns are not
+ *        renumbered, the solution needs no mapping back.
+ *
+ * @param inst Pointer to the instance (matrix by columns and row data already read, not compressed).
+ */
+void reorder_rows(INSTANCE* inst);
+
+/**
+ * @brief Sort rows by increasing degree (number of nonzeros), then by index.
+ *
+ * @param rows Rows to sort.
+ * @param len Number of rows.
+ * @param rbeg Begin index of the columns of each row (nrows + 1 entries).
+ * @param key Support array of sort keys (at least \p len entries).
+ */
+void sort_by_degree(int* rows, int len, nzind_t* rbeg, long long* key);
+
+/**
+ * @brief Apply new row indices to the matrix (rows sorted within each column), the row records,
+ *        the senses, the right hand sides and the row view (if any), and keep the original index of each row.
+ *
+ * @param inst Pointer to the instance.
+ * @param newrow New index of each row.
+ */
+void permute_rows(INSTANCE* inst, int* newrow);
+
+/**
+ * @brief Average distance between the first and the last row index of the columns (locality measure).
+ *
+ * @param inst Pointer to the instance.
+ * @return Average row index span of the columns.
+ */
+double column_span(INSTANCE* inst);
+
+/**
+ * @brief Compare two row sort keys (for qsort, ascending order).
+ *
+ * @param a Pointer to the first key.
+ * @param b Pointer to the second key.
+ * @return Negative, zero or positive if the first key is less, equal or greater than the second one.
+ */
+int compare_row_keys(const void* a, const void* b);
+
+/**
+ * @brief Compare two nonzeros by row index (for qsort, ascending order).
+ *
+ * @param a Pointer to the first nonzero.
+ * @param b Pointer to the second nonzero.
+ * @return Negative, zero or positive if the first row index is less, equal or greater than the second one.
+ */
+int compare_nonzeros(const void* a, const void* b);
+// -----------------------------------------------------------------------------------------------------
+
+// COMPRESS.C ------------------------------------------------------------------------------------------
+
+/**
+ * @brief Compress the matrix by columns (if enabled): row indices as zigzag varint deltas and, if the matrix
+ *        has at most CSC_DICT_MAX distinct coefficients, coefficients as one byte dictionary codes.
+ *        Frees cmatind (and cmatval if coded), the columns are then read with col_begin/col_next.
+ *
+ * @param inst Pointer to the instance (matrix by columns already read).
+ */
+void compress_columns(INSTANCE* inst);
+
+/**
+ * @brief Store the coefficients in single precision (if enabled).
+ *        Used only if every coefficient is reproduced exactly, so the rounding and the final
+ *        check of the constraints work on the same double coefficients as without it.
+ *
+ * @param inst Pointer to the instance (matrix by columns already read and compressed, if enabled).
+ */
+void narrow_coefficients(INSTANCE* inst);
+// -----------------------------------------------------------------------------------------------------
+
+// MMAP_STORE.C ----------------------------------------------------------------------------------------
+
+/**
+ * @brief Create and map the store of the instance (if enabled), sized for the matrix by columns,
+ *        the objective, the bounds and the variable types. Also enables the CSC-only mode.
+ *
+ * @param inst Pointer to the instance (problem sizes already read).
+ */
+void open_store(INSTANCE* inst);
+
+/**
+ * @brief Allocate an array of the column data: the next section of the store if open, memory otherwise.
+ *
+ * @param inst Pointer to the instance.
+ * @param size Size of the array in bytes.
+ * @return Pointer to the array.
+ */
+void* store_alloc(INSTANCE* inst, size_t size);
+
+/**
+ * @brief Move the variable types into the store and give the access hints of the mapped data.
+ *
+ * @param inst Pointer to the populated instance.
+ */
+void finalize_store(INSTANCE* inst);
+
+/**
+ * @brief Unmap and delete the store of the instance (the arrays in the store are set to NULL).
+ *
+ * @param inst Pointer to the instance.
+ */
+void close_store(INSTANCE* inst);
+
+/**
+ * @brief Size of a section of the store (rounded up to STORE_ALIGN bytes).
+ *
+ * @param size Size of the array in bytes.
+ * @return Size of the section in bytes.
+ */
+size_t store_section(size_t size);
+// -----------------------------------------------------------------------------------------------------
+
+// ONEOPT.C --------------------------------------------------------------------------------------------
+
+/**
+ * @brief Improve the objective of the current solution by shifting its non-fractional integer
+ *        variables (1-opt), in decreasing order of objective gain.
+ *
+ * @details The gains of all the candidate columns are computed in parallel and kept in a max-heap.
+ *          After each shift, only the columns sharing a row with the shifted one are evaluated again.
+ *
+ * @param inst Pointer to the already populated instance.
+ */
+void one_opt(INSTANCE* inst);
+
+/**
+ * @brief Compute the objective gain of the best integral shift of a non-fractional integer variable.
+ *
+ * @param inst Pointer to the already populated instance.
+ * @param j Variable index.
+ * @param delta_up Array of possible up-shifts (the j-th entry is updated).
+ * @param delta_down Array of possible down-shifts (the j-th entry is updated).
+ * @return Objective improvement of the best shift (zero if no shift improves the objective).
+ */
+double oneopt_gain(INSTANCE* inst, int j, double* delta_up, double* delta_down);
+
+/**
+ * @brief Compute the objective gain of the best of two integral shifts of a variable.
+ *
+ * @param inst Pointer to the already populated instance.
+ * @param j Variable index.
+ * @param delta_up Integral up-shift.
+ * @param delta_down Integral down-shift.
+ * @return Objective improvement of the best shift (zero if none improves).
+ */
+double oneopt_shift_gain(INSTANCE* inst, int j, double delta_up, double delta_down);
+
+/**
+ * @brief Check whether a variable is a candidate of the 1-opt phase, i.e. a non-fixed integer
+ *        variable with a non-zero objective coefficient and an integral value.
+ *
+ * @param inst Pointer to the already populated instance.
+ * @param j Variable index.
+ * @return 1 if the variable is a candidate, 0 otherwise.
+ */
+int oneopt_candidate(INSTANCE* inst, int j);
+// -----------------------------------------------------------------------------------------------------
+
+// UTIL.C ----------------------------------------------------------------------------------------------
+
+/**
+ * @brief Check that all the variable bounds are satisfied, for the given solution \p x.
+ *
+ * @param x Solution to be used for evaluating bounds satisfiability.
+ * @param lb Lower bounds of the variables.
+ * @param ub Upper bounds of the variables.
+ * @param ncols Number of variables.
+ */
+void check_bounds(double* x, double* lb, double* ub, int ncols);
+
+/**
+ * @brief Check whether all the constraints are satisfied, for the given solution \p x.
+ *
+ * @param x Solution to be used for evaluating constraints satisfiability.
+ * @param ncols Number of variables.
+ * @param nrows Number of constraints.
+ * @param rmatbeg Constraints begin indices structure (nrows + 1 entries, the last one is the number of non-zero coefficients).
+ * @param rmatind Constraints column indices structure.
+ * @param rmatval Constraint coefficients.
+ * @param sense Constraint senses.
+ * @param rhs Constraint right hand sides.
+ * @param row_orig Original index of each row, for the messages (NULL if the rows were not renumbered).
+ */
+void check_constraints(double* x, int ncols, int nrows, nzind_t* rmatbeg, int* rmatind, double* rmatval, char* sense, double* rhs, int* row_orig);
+
+/**
+ * @brief Check whether all the constraints are satisfied by the current solution of the instance,
+ *        computing the row activities column by column (no row view needed, plain or compressed columns).
+ *
+ * @param inst Pointer to the already populated instance.
+ */
+void check_constraints_csc(INSTANCE* inst);
+
+/**
+ * @brief Check a row activity against the sense and the right hand side of its constraint.
+ *
+ * @param i Index of the constraint (printed if violated).
+ * @param rowact Row activity.
+ * @param sense Constraint sense.
+ * @param rhs Constraint right hand side.
+ * @return 1 if the constraint is violated, 0 otherwise.
+ */
+int row_violated(int i, double rowact, char sense, double rhs);
+
+/**
+ * @brief Check whether all the constraints are satisfied by the current solution of the instance,
+ *        with the row view if available, column by column otherwise (CSC-only mode).
+ *
+ * @param inst Pointer to the already populated instance.
+ */
+void check_inst_constraints(INSTANCE* inst);
+
+/**
+ * @brief Check whether all the integer variables of the original MIP have been rounded.
+ *
+ * @param x Current solution.
+ * @param ncols Number of variables.
+ * @param int_var Array of flags for binary/integer variables in the original MIP.
+ * @param vartype Array of variable types.
+ * @return 1 iff all integer/binary variables have been rounded, 0 otherwise.
+ */
+int check_rounding(double* x, int ncols, int* int_var, char* vartype);
+
+/**
+ * @brief Count number of variables rounded so far.
+ *
+ * @param x Current solution.
+ * @param ncols Number of variables.
+ * @param int_var Array of flags for binary/integer variables in the original MIP.
+ * @param vartype Array of variable types.
+ * @return Number of variables rounded so far.
+ */
+int count_rounded(double* x, int ncols, int* int_var, char* vartype);
+
+/**
+ * @brief Calculate the fractionality of the given value.
+ *
+ * @param xj Value.
+ * @return Fractionality of the value.
+ */
+double fractionality(double xj);
+
+/**
+ * @brief Calculate the fractionality of a solution.
+ *
+ * @param x Solution.
+ * @param int_var Flags array for integer variables.
+ * @param len Length of the array.
+ * @return Fractionality of the solution.
+ */
+double sol_fractionality(double* x, int* int_var, int len);
+
+/**
+ * @brief Check the integrality of the given value.
+ *
+ * @param num Value.
+ * @return 1 if the value is fractional, 0 otherwise.
+ */
+int is_fractional(double num);
+
+/**
+ * @brief Calculate the dot product of two arrays (of the same length).
+ *
+ * @param coef First array.
+ * @param var_value Second array.
+ * @param len Length of both arrays.
+ * @return Dot product of the two arrays.
+ */
+double dot_product(double* coef, double* var_value, int len);
+
+/**
+ * @brief Add a value to a running sum with Neumaier compensation: the low-order part lost by the
+ *        sum is accumulated apart, the compensated sum is \p sum + \p comp.
+ *
+ * @param sum Running sum.
+ * @param comp Compensation of the running sum.
+ * @param value Value to add.
+ */
+void neumaier_add(double* sum, double* comp, double value);
+
+/**
+ * @brief Free memory allocated to multiple pointers.
+ *
+ * @details It does not check the type of the passed ellipsis parameters, so
+ * be sure that actual pointers are passed. Use with care.
+ *
+ * @param count The number of pointers.
+ * @param ... The actual pointers.
+ */
+void free_all(int count, ...);
+
+/**
+ * @brief Allocate an empty heap.
+ *
+ * @param heap Pointer to the heap.
+ * @param len Initial maximum number of entries (resizable).
+ */
+void heap_init(HEAP* heap, int len);
+
+/**
+ * @brief Push a new entry into the heap.
+ *
+ * @param heap Pointer to the heap.
+ * @param col Column index of the entry.
+ * @param key Key of the entry.
+ * @param stamp Current stamp of the column.
+ */
+void heap_push(HEAP* heap, int col, double key, int stamp);
+
+/**
+ * @brief Pop the entry with the maximum key from the heap.
+ *
+ * @param heap Pointer to the (non-empty) heap.
+ * @param col Column index of the popped entry.
+ * @param key Key of the popped entry.
+ * @param stamp Stamp of the popped entry.
+ */
+void heap_pop(HEAP* heap, int* col, double* key, int* stamp);
+
+/**
+ * @brief Deallocate the entries of the heap.
+ *
+ * @param heap Pointer to the heap.
+ */
+void heap_free(HEAP* heap);
+
+/**
+ * @brief Fill an array with a random permutation of 0..n-1 (Fisher-Yates shuffle).
+ *
+ * @details Uses a private xorshift generator, so that permutations can be drawn
+ *          independently of rand() and of the other threads.
+ *
+ * @param perm Array to fill.
+ * @param n Length of the array.
+ * @param seed Seed of the generator.
+ */
+void random_permutation(int* perm, int n, unsigned int seed);
+
+/**
+ * @brief Allocate an empty sparse set of column indices.
+ *
+ * @param set Pointer to the set.
+ * @param ncols Number of columns (indices range from 0 to ncols-1).
+ */
+void sset_init(SPARSE_SET* set, int ncols);
+
+/**
+ * @brief Insert a column into the sparse set (nothing happens if already in the set).
+ *
+ * @param set Pointer to the set.
+ * @param col Column index.
+ */
+void sset_insert(SPARSE_SET* set, int col);
+
+/**
+ * @brief Remove a column from the sparse set (nothing happens if not in the set).
+ *
+ * @param set Pointer to the set.
+ * @param col Column index.
+ */
+void sset_remove(SPARSE_SET* set, int col);
+
+/**
+ * @brief Deallocate the sparse set.
+ *
+ * @param set Pointer to the set.
+ */
+void sset_free(SPARSE_SET* set);
+
+/**
+ * @brief Compare two integers (for qsort, ascending order).
+ *
+ * @param a Pointer to the first integer.
+ * @param b Pointer to the second integer.
+ * @return Negative, zero or positive if the first integer is less, equal or greater than the second one.
+ */
+int compare_int(const void* a, const void* b);
+
+/**
+ * @brief Compare two doubles (for qsort and bsearch, ascending order).
+ *
+ * @param a Pointer to the first double.
+ * @param b Pointer to the second double.
+ * @return Negative, zero or positive if the first double is less, equal or greater than the second one.
+ */
+int compare_double(const void* a, const void* b);
 
 /**
  * @brief Create a text file with the list of instances in a folder (instances must be .mps files).